@@ -7,13 +7,13 @@ CONFIG(debug, debug|release){
 
 unix:!macx{
     LIBS += /usr/lib/libGLU.so
-    LIBS += -frounding-math -lgmp -lCGAL
+    LIBS += -frounding-math -lgmp -lCGAL -pthread
     LIBS+=/usr/lib/libboost_system.so.1.62.0
     LIBS+=/usr/lib/libQGLViewer-qt5.so
 
 
     DEFINES += CGAL_DEFINED
-    QMAKE_CXXFLAGS += -std=c++11 -g
+    QMAKE_CXXFLAGS += -std=c++11 -g -pthread
 }
 
 macx{
@@ -49,6 +49,7 @@ HEADERS += \
     lib/dcel/dcel_struct.h \
     lib/dcel/dcel_vertex.h \
     lib/dcel/dcel_vertex_iterators.h \
+    lib/dcel/dcel_pool.h \
     lib/dcel/drawable_dcel.h \
     lib/common/common.h \
     common.h \
@@ -57,7 +58,17 @@ HEADERS += \
     conflictgraph.h \
     tetrahedronbuilder.h \
     facebuilderhelper.h \
-    convexhullbuilderhelper.h
+    convexhullbuilderhelper.h \
+    convexhullobserver.h \
+    faceplanes.h \
+    parallelconvexhullbuilder.h \
+    extremepointsfilter.h \
+    predicates.h \
+    scratcharena.h \
+    hullmesh.h \
+    hullstatistics.h \
+    streamingconvexhullbuilder.h \
+    GUI/observers/showphasesobserver.h
 
 SOURCES += \
     GUI/managers/dcelmanager.cpp \
@@ -76,7 +87,16 @@ SOURCES += \
     conflictgraph.cpp \
     tetrahedronbuilder.cpp \
     facebuilderhelper.cpp \
-    convexhullbuilderhelper.cpp
+    convexhullbuilderhelper.cpp \
+    faceplanes.cpp \
+    parallelconvexhullbuilder.cpp \
+    extremepointsfilter.cpp \
+    predicates.cpp \
+    scratcharena.cpp \
+    hullmesh.cpp \
+    hullstatistics.cpp \
+    streamingconvexhullbuilder.cpp \
+    GUI/observers/showphasesobserver.cpp
 
 FORMS += \
     GUI/managers/dcelmanager.ui \
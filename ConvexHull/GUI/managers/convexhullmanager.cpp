@@ -1,5 +1,6 @@
 #include "convexhullmanager.h"
 #include "ui_convexhullmanager.h"
+#include <QMessageBox>
 
 ConvexHullManager::ConvexHullManager(QWidget *parent) : QFrame(parent), ui(new Ui::ConvexHullManager), mainWindow((MainWindow*)parent), drawableDcel(nullptr), dcelCHManager(nullptr) {
     ui->setupUi(this);
@@ -19,6 +20,7 @@ ConvexHullManager::~ConvexHullManager() {
 void ConvexHullManager::enableCHButton() {
     ui->convexHullPushButton->setEnabled(true);
     ui->showPhasesCheckBox->setEnabled(true);
+    ui->quickhullCheckBox->setEnabled(true);
 }
 
 /**
@@ -29,6 +31,7 @@ void ConvexHullManager::enableCHButton() {
 void ConvexHullManager::disableCHButton() {
     ui->convexHullPushButton->setEnabled(false);
     ui->showPhasesCheckBox->setEnabled(false);
+    ui->quickhullCheckBox->setEnabled(false);
 }
 
 /**
@@ -53,27 +56,34 @@ void ConvexHullManager::on_convexHullPushButton_clicked() {
             dcel->setFlatShading();
             dcel->setEnableTriangleColor();
 
-            Timer t("Convex Hull"); // timer
+            //Wall-clock time of each phase, the ones of the builder are nested in Convex Hull
+            TimerTree timerTree;
+            ScopedTimer convexHullTimer(&timerTree, "Convex Hull");
 
             /********************************
              * Begin Convex Hull Algorithm  *
              ********************************/
 
-            bool showPhases = false;
+            ConvexHullBuilder::Strategy strategy = ui->quickhullCheckBox->isChecked() ? ConvexHullBuilder::QUICKHULL : ConvexHullBuilder::RANDOMIZED_INCREMENTAL;
+            ConvexHullBuilder convexHullBuilder(dcel, strategy);
+            //Rendering each phase is just an optional subscriber of the builder
+            ShowPhasesObserver showPhasesObserver(dcel, mainWindow);
             if(ui->showPhasesCheckBox->isChecked()){
-              showPhases = true;
+                convexHullBuilder.addObserver(&showPhasesObserver);
+            }
+            convexHullBuilder.setTimerTree(&timerTree);
+            if( !convexHullBuilder.computeConvexHull() ){
+                QMessageBox::warning(this, "Convex Hull", "The mesh has less than 4 vertices or they are all coplanar, it has no convex hull.");
             }
-            ConvexHullBuilder convexHullBuilder(dcel, mainWindow, showPhases);
-            convexHullBuilder.computeConvexHull();
 
             /********************************
              * End Convex Hull Algorithm    *
              ********************************/
 
-            t.stop_and_print();
+            convexHullTimer.stop();
             std::stringstream ss;
             ss << std::setprecision(std::numeric_limits<double>::digits10+1);
-            ss << t.delay();
+            ss << timerTree.getSecs("Convex Hull");
             ui->timeLabel->setText(ss.str().c_str());
 
             // Coloring Convex hull with cyano color
@@ -86,6 +96,7 @@ void ConvexHullManager::on_convexHullPushButton_clicked() {
              * These fields are necessary for the mesh rendering, therefore if this method crashes,
              * you cannot view the result until all next and prev are setted properly.
              *****/
+            ScopedTimer normalsTimer(&timerTree, "Normals");
             dcel->updateFaceNormals();
             /***
              * Warning: updateVertexNormals() crashes if there is at least one half edge which doesn't have
@@ -96,11 +107,18 @@ void ConvexHullManager::on_convexHullPushButton_clicked() {
              * In other words: your convex hull must have all the twin fields setted properly.
              *****/
              dcel->updateVertexNormals();
+            normalsTimer.stop();
 
             //Final operations to render the final dcel
 
+            ScopedTimer renderBuffersTimer(&timerTree, "Render buffers");
             dcel->update();
+            renderBuffersTimer.stop();
             mainWindow->updateGlCanvas();
+
+            //Breakdown of the phases
+            std::cout << timerTree.toString();
+            ui->phasesLabel->setText(timerTree.toString().c_str());
         }
 
     }
@@ -12,6 +12,7 @@
 // Add your includes here:
 
 #include "convexhullbuilder.h"
+#include "GUI/observers/showphasesobserver.h"
 
 // End includes
 
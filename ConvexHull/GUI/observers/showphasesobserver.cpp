@@ -0,0 +1,51 @@
+#include "showphasesobserver.h"
+
+/**
+ * @brief ShowPhasesObserver::ShowPhasesObserver()
+ * @params DrawableDcel* drawableDcel, MainWindow* mainWindow
+ */
+ShowPhasesObserver::ShowPhasesObserver(DrawableDcel* drawableDcel, MainWindow* mainWindow){
+    this->drawableDcel = drawableDcel;
+    this->mainWindow   = mainWindow;
+}
+
+/**
+ * @brief ShowPhasesObserver Class Destructor
+ **/
+ShowPhasesObserver::~ShowPhasesObserver(){}
+
+/**
+ * @brief ShowPhasesObserver::getEvents()
+ *        Only the tetrahedron and the hull after each inserted vertex are shown
+ * @return unsigned int mask of the handled events
+ */
+unsigned int ShowPhasesObserver::getEvents() const{
+    return TETRAHEDRON_BUILT | POINT_INSERTED;
+}
+
+/**
+ * @brief ShowPhasesObserver::onTetrahedronBuilt(Dcel* dcel)
+ *        Shows the Tetrahedron
+ * @param Dcel* dcel
+ */
+void ShowPhasesObserver::onTetrahedronBuilt(Dcel* /*dcel*/){
+    render();
+}
+
+/**
+ * @brief ShowPhasesObserver::onPointInserted(Dcel* dcel, Pointd const &point)
+ *        Shows the progress after each inserted vertex
+ * @param Dcel* dcel, Pointd const &point
+ */
+void ShowPhasesObserver::onPointInserted(Dcel* /*dcel*/, Pointd const &/*point*/){
+    render();
+}
+
+/**
+ * @brief ShowPhasesObserver::render()
+ *        Updates the drawable dcel buffers and the canvas
+ */
+void ShowPhasesObserver::render(){
+    drawableDcel->update();
+    mainWindow->updateGlCanvas();
+}
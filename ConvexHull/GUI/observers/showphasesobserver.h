@@ -0,0 +1,30 @@
+#ifndef SHOWPHASESOBSERVER_H
+#define SHOWPHASESOBSERVER_H
+
+#include "lib/dcel/drawable_dcel.h"
+#include "GUI/mainwindow.h"
+#include "convexhullobserver.h"
+
+/**
+ * @brief ShowPhasesObserver
+ *        Renders the dcel in the canvas after the tetrahedron has been built and after
+ *        each vertex has been inserted in the convex hull ("Show Phases" checkbox).
+ */
+class ShowPhasesObserver : public ConvexHullObserver{
+
+public:
+    ShowPhasesObserver(DrawableDcel* drawableDcel, MainWindow* mainWindow);
+    ~ShowPhasesObserver(); //Destructor Declaration
+
+    unsigned int getEvents() const;
+    void onTetrahedronBuilt(Dcel* dcel);
+    void onPointInserted(Dcel* dcel, Pointd const &point);
+
+private:
+    DrawableDcel *drawableDcel;
+    MainWindow   *mainWindow;
+
+    void render();
+};
+
+#endif // SHOWPHASESOBSERVER_H
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <dirent.h>
+
+#include "lib/dcel/dcel.h"
+#include "convexhullbuilder.h"
+#include "workstealingpool.h"
+
+/**
+ * Batch Convex Hull Builder.
+ * Computes the convex hull of many OBJ or PLY models and saves each one in the output directory with the same name.
+ * Each model is a load + hull + save job with a single threaded ConvexHullBuilder, the jobs run on a work stealing
+ * pool: the largest files are started first and the threads which finish early steal the jobs left to the others.
+ *
+ * Usage: convexhull_batch [-t threads] [-q] [-f] [-s seed] [-l list] -o outdir [dir|file]...
+ *        -t threads   number of jobs run at the same time, 0 (default) means number of hardware threads
+ *        -q           Quickhull strategy instead of the randomized incremental one
+ *        -f           discard the points inside the polytope of the extreme points before building each hull
+ *        -s seed      seed of the random insertion order, runs with the same seed build the same hulls
+ *        -l list      text file with the path of one model per line
+ *        -o outdir    directory where the hulls are saved, it must exist
+ *        Directories are not visited recursively, only their .obj and .ply files are taken.
+ */
+
+/** Outcome of the job of one model **/
+struct JobResult{
+    bool          built;
+    std::string   message;
+    unsigned int  points;
+    unsigned int  hullVertices;
+    unsigned int  hullFaces;
+    double        loadSecs;
+    double        hullSecs;
+    double        saveSecs;
+};
+
+/**
+ * @brief getExtension(const std::string &filename)
+ *        Returns the extension of the passed filename (without the dot)
+ * @param  const std::string &filename
+ * @return std::string extension, empty if the filename has none
+ */
+static std::string getExtension(const std::string &filename){
+    size_t lastDot = filename.find_last_of(".");
+    if( lastDot == std::string::npos ){
+        return "";
+    }
+    return filename.substr(lastDot + 1);
+}
+
+/**
+ * @brief getBaseName(const std::string &filename)
+ * @param  const std::string &filename
+ * @return std::string filename without its directories
+ */
+static std::string getBaseName(const std::string &filename){
+    size_t lastSlash = filename.find_last_of("/");
+    return lastSlash == std::string::npos ? filename : filename.substr(lastSlash + 1);
+}
+
+/**
+ * @brief isModel(const std::string &filename)
+ * @param  const std::string &filename
+ * @return true if the file is an OBJ or a PLY
+ */
+static bool isModel(const std::string &filename){
+    std::string extension = getExtension(filename);
+    return extension == "obj" || extension == "ply";
+}
+
+/**
+ * @brief addDirectory(const std::string &directory, std::vector<std::string> &files)
+ *        Adds the models in the directory, sorted by name
+ * @param  const std::string &directory, std::vector<std::string> &files
+ * @return false if the directory cannot be opened
+ */
+static bool addDirectory(const std::string &directory, std::vector<std::string> &files){
+    DIR *dir = opendir(directory.c_str());
+    if( dir == nullptr ){
+        return false;
+    }
+    std::vector<std::string> models;
+    for(struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)){
+        std::string name = entry->d_name;
+        if( isModel(name) ){
+            models.push_back(directory + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(models.begin(), models.end());
+    files.insert(files.end(), models.begin(), models.end());
+    return true;
+}
+
+/**
+ * @brief getFileSize(const std::string &filename)
+ * @param  const std::string &filename
+ * @return long long size of the file in bytes, -1 if it cannot be opened
+ */
+static long long getFileSize(const std::string &filename){
+    std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+    return file.good() ? (long long) file.tellg() : -1;
+}
+
+/**
+ * @brief secondsSince(std::chrono::steady_clock::time_point start)
+ * @param  std::chrono::steady_clock::time_point start
+ * @return double wall-clock seconds elapsed since start
+ */
+static double secondsSince(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief buildHull(const std::string &inputFile, const std::string &outputFile, ConvexHullBuilder::Strategy strategy,
+ *                  bool prefilter, bool seeded, unsigned int seed, JobResult &result)
+ *        The job of one model: loads it, builds its hull on the calling thread and saves it with its normals
+ * @param  const std::string &inputFile, const std::string &outputFile, ConvexHullBuilder::Strategy strategy,
+ *         bool prefilter, bool seeded, unsigned int seed, JobResult &result filled with the outcome and the timings
+ */
+static void buildHull(const std::string &inputFile, const std::string &outputFile, ConvexHullBuilder::Strategy strategy,
+                      bool prefilter, bool seeded, unsigned int seed, JobResult &result){
+    result.built = false;
+    result.points = result.hullVertices = result.hullFaces = 0;
+    result.loadSecs = result.hullSecs = result.saveSecs = 0;
+
+    //The loaders do not return if the file cannot be opened
+    if( !std::ifstream(inputFile.c_str()).good() ){
+        result.message = "could not open input file";
+        return;
+    }
+
+    Dcel dcel;
+
+    //Load
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if( getExtension(inputFile) == "obj" ){
+        dcel.loadFromObjFile(inputFile);
+    } else {
+        dcel.loadFromPlyFile(inputFile);
+    }
+    result.loadSecs = secondsSince(start);
+    result.points = dcel.getNumberVertices();
+
+    //Convex Hull, the pool already keeps every thread busy
+    start = std::chrono::steady_clock::now();
+    ConvexHullBuilder convexHullBuilder(&dcel, strategy);
+    convexHullBuilder.setNumberOfThreads(1);
+    convexHullBuilder.setPrefilter(prefilter);
+    if( seeded ) convexHullBuilder.setSeed(seed);
+    result.built = convexHullBuilder.computeConvexHull();
+    result.hullSecs = secondsSince(start);
+    if( !result.built ){
+        result.message = "less than 4 points or all coplanar, no convex hull";
+        return;
+    }
+    result.hullVertices = dcel.getNumberVertices();
+    result.hullFaces = dcel.getNumberFaces();
+
+    //Save
+    start = std::chrono::steady_clock::now();
+    dcel.updateFaceNormals();
+    dcel.updateVertexNormals();
+    if( getExtension(outputFile) == "obj" ){
+        dcel.saveOnObjFile(outputFile);
+    } else {
+        dcel.saveOnPlyFile(outputFile);
+    }
+    result.saveSecs = secondsSince(start);
+    result.message = outputFile;
+}
+
+int main(int argc, char *argv[]) {
+
+    unsigned int numberOfThreads = 0;
+    ConvexHullBuilder::Strategy strategy = ConvexHullBuilder::RANDOMIZED_INCREMENTAL;
+    bool prefilter = false;
+    bool seeded = false;
+    unsigned int seed = 0;
+    std::string outputDirectory;
+    std::vector<std::string> files;
+
+    //Parse options, the remaining arguments are models or directories of models
+    for(int i = 1; i < argc; i++){
+        std::string argument = argv[i];
+        if( (argument == "-t" || argument == "--threads") && i + 1 < argc ){
+            numberOfThreads = std::strtoul(argv[++i], nullptr, 10);
+        } else if( argument == "-q" || argument == "--quickhull" ){
+            strategy = ConvexHullBuilder::QUICKHULL;
+        } else if( argument == "-f" || argument == "--prefilter" ){
+            prefilter = true;
+        } else if( (argument == "-s" || argument == "--seed") && i + 1 < argc ){
+            seed = std::strtoul(argv[++i], nullptr, 10);
+            seeded = true;
+        } else if( (argument == "-o" || argument == "--output") && i + 1 < argc ){
+            outputDirectory = argv[++i];
+        } else if( (argument == "-l" || argument == "--list") && i + 1 < argc ){
+            std::ifstream list(argv[++i]);
+            if( !list.good() ){
+                std::cerr << "Could not open list file: " << argv[i] << std::endl;
+                return 1;
+            }
+            std::string line;
+            while( std::getline(list, line) ){
+                if( !line.empty() ){
+                    files.push_back(line);
+                }
+            }
+        } else if( isModel(argument) ){
+            files.push_back(argument);
+        } else if( !addDirectory(argument, files) ){
+            std::cerr << "Not a model nor a directory: " << argument << std::endl;
+            return 1;
+        }
+    }
+
+    if( outputDirectory.empty() || files.empty() ){
+        std::cerr << "Usage: " << argv[0] << " [-t threads] [-q] [-f] [-s seed] [-l list] -o outdir [dir|file]..." << std::endl;
+        return 1;
+    }
+
+    //Largest files first, so that they do not start last and keep one thread busy alone at the end
+    std::vector<long long> fileSizes(files.size());
+    std::vector<unsigned int> order(files.size());
+    for(unsigned int i = 0; i < files.size(); i++){
+        fileSizes[i] = getFileSize(files[i]);
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&fileSizes](unsigned int a, unsigned int b){ return fileSizes[a] > fileSizes[b]; });
+
+    //Each job writes only its own result
+    std::vector<JobResult> results(files.size());
+    WorkStealingPool workStealingPool(numberOfThreads);
+    for(auto orderIterator = order.begin(); orderIterator != order.end(); orderIterator++){
+        unsigned int i = *orderIterator;
+        std::string outputFile = outputDirectory + "/" + getBaseName(files[i]);
+        workStealingPool.submit([&files, &results, i, outputFile, strategy, prefilter, seeded, seed](){
+            buildHull(files[i], outputFile, strategy, prefilter, seeded, seed, results[i]);
+        });
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    workStealingPool.run();
+    double totalSecs = secondsSince(start);
+
+    //Per file report, in input order
+    unsigned int failed = 0;
+    std::cout << "file\tpoints\thull vertices\thull faces\tload secs\thull secs\tsave secs\toutput" << std::endl;
+    for(unsigned int i = 0; i < files.size(); i++){
+        JobResult const &result = results[i];
+        std::cout << files[i] << "\t" << result.points << "\t" << result.hullVertices << "\t" << result.hullFaces << "\t"
+                  << result.loadSecs << "\t" << result.hullSecs << "\t" << result.saveSecs << "\t" << result.message << std::endl;
+        if( !result.built ){
+            failed++;
+        }
+    }
+
+    std::cout << "[" << totalSecs << " secs]\tTotal" << std::endl;
+    std::cout << "batch: " << files.size() << " models, " << failed << " failed, " << workStealingPool.getNumberOfThreads()
+              << " threads; " << files.size() / totalSecs << " models/sec." << std::endl;
+
+    return failed > 0 ? 1 : 0;
+}
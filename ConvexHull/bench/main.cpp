@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <dirent.h>
+
+#include "lib/dcel/dcel.h"
+#include "convexhullbuilder.h"
+
+/**
+ * Convex Hull Builder Benchmark.
+ * Times ConvexHullBuilder::computeConvexHull on every model of a directory and on generated point clouds:
+ * uniform in a cube, uniform in a ball, on a sphere (every point is on the hull, the worst case) and gaussian.
+ * The clouds and the insertion orders come from fixed seeds, so two runs time the very same work.
+ * Each input is built several times, loading and generating the points are not timed.
+ *
+ * Usage: convexhull_bench [-t threads] [-q] [-f] [-r trials] [-n sizes] [-m models]
+ *        -t threads   maximum number of threads used by the builder, 0 (default) means number of hardware threads
+ *        -q           Quickhull strategy instead of the randomized incremental one
+ *        -f           discard the points inside the polytope of the extreme points before building the hull
+ *        -r trials    number of builds of each input, 5 by default
+ *        -n sizes     comma separated numbers of points of the generated clouds, 10000,100000,1000000 by default
+ *        -m models    directory of the .obj and .ply models, ../models by default, "" to skip them
+ */
+
+/** Seed of the generated clouds, the insertion order of trial t uses builderSeed + t **/
+static const unsigned int cloudSeed   = 20170101;
+static const unsigned int builderSeed = 12345;
+
+/** Timings of the trials of one input **/
+struct BenchmarkResult{
+    std::string  input;
+    unsigned int points;
+    unsigned int hullVertices;
+    double       medianSecs;
+    double       p95Secs;
+};
+
+/**
+ * @brief getExtension(const std::string &filename)
+ *        Returns the extension of the passed filename (without the dot)
+ * @param  const std::string &filename
+ * @return std::string extension, empty if the filename has none
+ */
+static std::string getExtension(const std::string &filename){
+    size_t lastDot = filename.find_last_of(".");
+    if( lastDot == std::string::npos ){
+        return "";
+    }
+    return filename.substr(lastDot + 1);
+}
+
+/**
+ * @brief listModels(const std::string &directory)
+ * @param  const std::string &directory
+ * @return std::vector<std::string> .obj and .ply files of the directory, sorted by name, empty if it cannot be opened
+ */
+static std::vector<std::string> listModels(const std::string &directory){
+    std::vector<std::string> models;
+    DIR *dir = opendir(directory.c_str());
+    if( dir == nullptr ){
+        return models;
+    }
+    for(struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)){
+        std::string name = entry->d_name;
+        if( getExtension(name) == "obj" || getExtension(name) == "ply" ){
+            models.push_back(directory + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(models.begin(), models.end());
+    return models;
+}
+
+/**
+ * @brief loadCoordinates(const std::string &filename)
+ *        Loads the model and packs the coordinates of its vertices, x y z for each vertex
+ * @param  const std::string &filename
+ * @return std::vector<double> packed coordinates
+ */
+static std::vector<double> loadCoordinates(const std::string &filename){
+    Dcel dcel;
+    if( getExtension(filename) == "obj" ){
+        dcel.loadFromObjFile(filename);
+    } else {
+        dcel.loadFromPlyFile(filename);
+    }
+    std::vector<double> coordinates;
+    coordinates.reserve(dcel.getNumberVertices() * 3);
+    for(auto vertexIterator = dcel.vertexBegin(); vertexIterator != dcel.vertexEnd(); vertexIterator++){
+        Pointd coordinate = (*vertexIterator)->getCoordinate();
+        coordinates.push_back(coordinate.x());
+        coordinates.push_back(coordinate.y());
+        coordinates.push_back(coordinate.z());
+    }
+    return coordinates;
+}
+
+/**
+ * @brief generateCloud(const std::string &distribution, unsigned int const &pointsNumber)
+ *        Generates the packed coordinates of a cloud, always the same for the same distribution and size
+ *        - cube:     uniform in [-1, 1]^3
+ *        - ball:     uniform in the unit ball, cube points outside it are rejected
+ *        - sphere:   uniform on the unit sphere, gaussian vectors normalized
+ *        - gaussian: standard normal coordinates
+ * @param  const std::string &distribution, unsigned int const &pointsNumber
+ * @return std::vector<double> packed coordinates
+ */
+static std::vector<double> generateCloud(const std::string &distribution, unsigned int const &pointsNumber){
+    std::mt19937 generator(cloudSeed + pointsNumber);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    std::normal_distribution<double> normal(0, 1);
+
+    std::vector<double> coordinates;
+    coordinates.reserve(pointsNumber * 3);
+    while( coordinates.size() < pointsNumber * 3 ){
+        double point[3];
+        if( distribution == "cube" || distribution == "ball" ){
+            point[0] = uniform(generator);
+            point[1] = uniform(generator);
+            point[2] = uniform(generator);
+            if( distribution == "ball" && point[0] * point[0] + point[1] * point[1] + point[2] * point[2] > 1 ){
+                continue;
+            }
+        } else {
+            point[0] = normal(generator);
+            point[1] = normal(generator);
+            point[2] = normal(generator);
+            if( distribution == "sphere" ){
+                double norm = std::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2]);
+                if( norm == 0 ){
+                    continue;
+                }
+                point[0] /= norm;
+                point[1] /= norm;
+                point[2] /= norm;
+            }
+        }
+        coordinates.insert(coordinates.end(), point, point + 3);
+    }
+    return coordinates;
+}
+
+/**
+ * @brief percentile(std::vector<double> sortedSecs, double const &fraction)
+ *        Nearest rank percentile of sorted timings
+ * @param  std::vector<double> const &sortedSecs, double const &fraction in (0, 1]
+ * @return double seconds
+ */
+static double percentile(std::vector<double> const &sortedSecs, double const &fraction){
+    unsigned int rank = (unsigned int) std::ceil(fraction * sortedSecs.size());
+    return sortedSecs[std::max(rank, 1u) - 1];
+}
+
+/**
+ * @brief runTrials(const std::string &input, std::vector<double> const &coordinates, unsigned int const &trials,
+ *                  unsigned int const &numberOfThreads, ConvexHullBuilder::Strategy strategy, bool prefilter)
+ *        Builds the hull of the coordinates trials times, each time with a new dcel and builder,
+ *        and keeps the wall-clock time of each build
+ * @return BenchmarkResult median and 95th percentile of the timings
+ */
+static BenchmarkResult runTrials(const std::string &input, std::vector<double> const &coordinates, unsigned int const &trials,
+                                 unsigned int const &numberOfThreads, ConvexHullBuilder::Strategy strategy, bool prefilter){
+    BenchmarkResult result;
+    result.input = input;
+    result.points = coordinates.size() / 3;
+    result.hullVertices = 0;
+
+    std::vector<double> secs;
+    for(unsigned int t = 0; t < trials; t++){
+        Dcel dcel;
+        ConvexHullBuilder convexHullBuilder(&dcel, strategy);
+        convexHullBuilder.setNumberOfThreads(numberOfThreads);
+        convexHullBuilder.setPrefilter(prefilter);
+        convexHullBuilder.setSeed(builderSeed + t);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        convexHullBuilder.computeConvexHull(coordinates);
+        secs.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        result.hullVertices = dcel.getNumberVertices();
+    }
+
+    std::sort(secs.begin(), secs.end());
+    result.medianSecs = secs.size() % 2 == 1 ? secs[secs.size() / 2] : (secs[secs.size() / 2 - 1] + secs[secs.size() / 2]) / 2;
+    result.p95Secs = percentile(secs, 0.95);
+    return result;
+}
+
+/**
+ * @brief printResult(BenchmarkResult const &result)
+ *        Prints one row of the table, the throughput is the number of input points over the median time
+ * @param  BenchmarkResult const &result
+ */
+static void printResult(BenchmarkResult const &result){
+    std::cout << result.input << "\t" << result.points << "\t" << result.hullVertices << "\t"
+              << result.medianSecs << "\t" << result.p95Secs << "\t" << result.points / result.medianSecs << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    unsigned int numberOfThreads = 0;
+    ConvexHullBuilder::Strategy strategy = ConvexHullBuilder::RANDOMIZED_INCREMENTAL;
+    bool prefilter = false;
+    unsigned int trials = 5;
+    std::vector<unsigned int> sizes = {10000, 100000, 1000000};
+    std::string modelsDirectory = "../models";
+
+    //Parse options
+    for(int i = 1; i < argc; i++){
+        std::string argument = argv[i];
+        if( (argument == "-t" || argument == "--threads") && i + 1 < argc ){
+            numberOfThreads = std::strtoul(argv[++i], nullptr, 10);
+        } else if( argument == "-q" || argument == "--quickhull" ){
+            strategy = ConvexHullBuilder::QUICKHULL;
+        } else if( argument == "-f" || argument == "--prefilter" ){
+            prefilter = true;
+        } else if( (argument == "-r" || argument == "--trials") && i + 1 < argc ){
+            trials = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+        } else if( (argument == "-n" || argument == "--sizes") && i + 1 < argc ){
+            sizes.clear();
+            std::istringstream sizesStream(argv[++i]);
+            std::string size;
+            while( std::getline(sizesStream, size, ',') ){
+                if( std::strtoul(size.c_str(), nullptr, 10) > 0 ){
+                    sizes.push_back(std::strtoul(size.c_str(), nullptr, 10));
+                }
+            }
+        } else if( (argument == "-m" || argument == "--models") && i + 1 < argc ){
+            modelsDirectory = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [-t threads] [-q] [-f] [-r trials] [-n sizes] [-m models]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "input\tpoints\thull vertices\tmedian secs\tp95 secs\tpoints/sec" << std::endl;
+
+    //Models
+    if( !modelsDirectory.empty() ){
+        std::vector<std::string> models = listModels(modelsDirectory);
+        for(auto modelIterator = models.begin(); modelIterator != models.end(); modelIterator++){
+            std::vector<double> coordinates = loadCoordinates(*modelIterator);
+            printResult(runTrials(*modelIterator, coordinates, trials, numberOfThreads, strategy, prefilter));
+        }
+    }
+
+    //Generated clouds
+    const std::vector<std::string> distributions = {"cube", "ball", "sphere", "gaussian"};
+    for(auto distributionIterator = distributions.begin(); distributionIterator != distributions.end(); distributionIterator++){
+        for(auto sizeIterator = sizes.begin(); sizeIterator != sizes.end(); sizeIterator++){
+            std::vector<double> coordinates = generateCloud(*distributionIterator, *sizeIterator);
+            std::ostringstream input;
+            input << *distributionIterator << "-" << *sizeIterator;
+            printResult(runTrials(input.str(), coordinates, trials, numberOfThreads, strategy, prefilter));
+        }
+    }
+
+    std::cout << "bench: " << trials << " trials per input, " << (strategy == ConvexHullBuilder::QUICKHULL ? "quickhull" : "randomized incremental")
+              << (prefilter ? " with prefilter" : "") << "." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "lib/dcel/dcel.h"
+#include "convexhullbuilder.h"
+#include "parallelconvexhullbuilder.h"
+#include "streamingconvexhullbuilder.h"
+#include "lib/common/timer.h"
+
+/**
+ * Headless Convex Hull Builder.
+ * Loads a mesh from an OBJ or PLY file, computes its convex hull and saves it on an OBJ or PLY file.
+ * No Qt GUI or OpenGL context is needed, so it can be run in batch jobs on machines with no display.
+ *
+ * Usage: convexhull_cli [-t threads] [-q] [-p] [-f] [-s seed] [-c points] [-j] <input.obj|input.ply> <output.obj|output.ply>
+ *        -t threads   maximum number of threads used by the builder, 0 (default) means number of hardware threads
+ *        -q           Quickhull strategy instead of the randomized incremental one
+ *        -p           divide and conquer: the hulls of spatial chunks are built in parallel and then merged
+ *        -f           discard the points inside the polytope of the extreme points before building the hull
+ *        -s seed      seed of the random insertion order, runs with the same seed build the same hull
+ *        -c points    stream the vertices of an OBJ input in chunks of this many points instead of loading the mesh,
+ *                     the memory used is bounded by the hull plus one chunk
+ *        -j           print the counters of the builder as JSON (see HullStatistics), with -p and -c the ones of all the
+ *                     chunks add up
+ */
+
+/**
+ * @brief getExtension(const std::string &filename)
+ *        Returns the extension of the passed filename (without the dot)
+ * @param  const std::string &filename
+ * @return std::string extension, empty if the filename has none
+ */
+static std::string getExtension(const std::string &filename){
+    size_t lastDot = filename.find_last_of(".");
+    if( lastDot == std::string::npos ){
+        return "";
+    }
+    return filename.substr(lastDot + 1);
+}
+
+int main(int argc, char *argv[]) {
+
+    unsigned int numberOfThreads = 0;
+    ConvexHullBuilder::Strategy strategy = ConvexHullBuilder::RANDOMIZED_INCREMENTAL;
+    bool divideAndConquer = false;
+    bool prefilter = false;
+    bool seeded = false;
+    unsigned int seed = 0;
+    unsigned int chunkSize = 0;
+    bool statistics = false;
+    std::vector<std::string> files;
+
+    //Parse options, the remaining arguments are the input and output files
+    for(int i = 1; i < argc; i++){
+        std::string argument = argv[i];
+        if( (argument == "-t" || argument == "--threads") && i + 1 < argc ){
+            numberOfThreads = std::strtoul(argv[++i], nullptr, 10);
+        } else if( argument == "-q" || argument == "--quickhull" ){
+            strategy = ConvexHullBuilder::QUICKHULL;
+        } else if( argument == "-p" || argument == "--parallel" ){
+            divideAndConquer = true;
+        } else if( argument == "-f" || argument == "--prefilter" ){
+            prefilter = true;
+        } else if( (argument == "-s" || argument == "--seed") && i + 1 < argc ){
+            seed = std::strtoul(argv[++i], nullptr, 10);
+            seeded = true;
+        } else if( argument == "-j" || argument == "--statistics" ){
+            statistics = true;
+        } else if( (argument == "-c" || argument == "--chunk") && i + 1 < argc ){
+            chunkSize = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            files.push_back(argument);
+        }
+    }
+
+    if( files.size() != 2 ){
+        std::cerr << "Usage: " << argv[0] << " [-t threads] [-q] [-p] [-f] [-s seed] [-c points] [-j] <input.obj|input.ply> <output.obj|output.ply>" << std::endl;
+        return 1;
+    }
+
+    std::string inputFile  = files[0];
+    std::string outputFile = files[1];
+    std::string inputExtension  = getExtension(inputFile);
+    std::string outputExtension = getExtension(outputFile);
+
+    if( inputExtension != "obj" && inputExtension != "ply" ){
+        std::cerr << "Unsupported input file: " << inputFile << std::endl;
+        return 1;
+    }
+    if( outputExtension != "obj" && outputExtension != "ply" ){
+        std::cerr << "Unsupported output file: " << outputFile << std::endl;
+        return 1;
+    }
+    if( !std::ifstream(inputFile.c_str()).good() ){
+        std::cerr << "Could not open input file: " << inputFile << std::endl;
+        return 1;
+    }
+
+    if( chunkSize > 0 && (inputExtension != "obj" || divideAndConquer) ){
+        std::cerr << "Streaming (-c) needs an OBJ input and cannot be combined with -p" << std::endl;
+        return 1;
+    }
+
+    Dcel dcel;
+    //Wall-clock time of each phase, the ones of the builder are nested in Convex Hull
+    TimerTree timerTree;
+
+    //Load, the streaming builder reads the file by itself
+    if( chunkSize == 0 ){
+        ScopedTimer loadTimer(&timerTree, "Load");
+        std::string loadInfo;
+        if( inputExtension == "obj" ){
+            loadInfo = dcel.loadFromObjFile(inputFile);
+        } else {
+            loadInfo = dcel.loadFromPlyFile(inputFile);
+        }
+        loadTimer.stop();
+        std::cout << "load: " << inputFile << " " << loadInfo << std::endl;
+    }
+
+    //Convex Hull
+    ScopedTimer convexHullTimer(&timerTree, "Convex Hull");
+    bool built;
+    std::size_t scratchPeakBytes = 0, scratchReservedBytes = 0;
+    if( chunkSize > 0 ){
+        StreamingConvexHullBuilder streamingConvexHullBuilder(&dcel, strategy);
+        streamingConvexHullBuilder.setNumberOfThreads(numberOfThreads);
+        streamingConvexHullBuilder.setPrefilter(prefilter);
+        streamingConvexHullBuilder.setChunkSize(chunkSize);
+        streamingConvexHullBuilder.setTimerTree(&timerTree);
+        if( statistics ) streamingConvexHullBuilder.setStatisticsOutput(&std::cout);
+        if( seeded ) streamingConvexHullBuilder.setSeed(seed);
+        built = streamingConvexHullBuilder.computeConvexHull(inputFile);
+        std::cout << "stream: " << inputFile << " Points: " << streamingConvexHullBuilder.getNumberPoints()
+                  << "; Chunk: " << chunkSize << " points." << std::endl;
+    } else if( divideAndConquer ){
+        ParallelConvexHullBuilder parallelConvexHullBuilder(&dcel, strategy);
+        parallelConvexHullBuilder.setNumberOfThreads(numberOfThreads);
+        parallelConvexHullBuilder.setPrefilter(prefilter);
+        if( seeded ) parallelConvexHullBuilder.setSeed(seed);
+        if( statistics ) parallelConvexHullBuilder.setStatisticsOutput(&std::cout);
+        built = parallelConvexHullBuilder.computeConvexHull();
+    } else {
+        ConvexHullBuilder convexHullBuilder(&dcel, strategy);
+        convexHullBuilder.setNumberOfThreads(numberOfThreads);
+        convexHullBuilder.setPrefilter(prefilter);
+        if( seeded ) convexHullBuilder.setSeed(seed);
+        if( statistics ) convexHullBuilder.setStatisticsOutput(&std::cout);
+        convexHullBuilder.setTimerTree(&timerTree);
+        built = convexHullBuilder.computeConvexHull();
+        scratchPeakBytes     = convexHullBuilder.getScratchPeakBytes();
+        scratchReservedBytes = convexHullBuilder.getScratchReservedBytes();
+    }
+    convexHullTimer.stop();
+    if( !built ){
+        std::cout << timerTree.toString();
+        std::cerr << "The input has less than 4 points or they are all coplanar, it has no convex hull" << std::endl;
+        return 1;
+    }
+    if( !divideAndConquer && chunkSize == 0 ){
+        std::cout << "scratch: peak " << scratchPeakBytes << " bytes per insertion; reserved " << scratchReservedBytes << " bytes." << std::endl;
+    }
+
+    //Normals
+    ScopedTimer normalsTimer(&timerTree, "Normals");
+    dcel.updateFaceNormals();
+    dcel.updateVertexNormals();
+    normalsTimer.stop();
+
+    //Save
+    ScopedTimer saveTimer(&timerTree, "Save");
+    if( outputExtension == "obj" ){
+        dcel.saveOnObjFile(outputFile);
+    } else {
+        dcel.saveOnPlyFile(outputFile);
+    }
+    saveTimer.stop();
+
+    std::cout << timerTree.toString();
+    std::cout << "[" << timerTree.getTotalSecs() << " secs]\tTotal" << std::endl;
+    std::cout << "save: " << outputFile << " Vertices: " << dcel.getNumberVertices()
+              << "; Half Edges: " << dcel.getNumberHalfEdges() << "; Faces: " << dcel.getNumberFaces() << "." << std::endl;
+
+    return 0;
+}
@@ -1,323 +1,470 @@
 #include "conflictgraph.h"
 #include <stdlib.h>
+#include <algorithm>
+#include <functional>
+
+const unsigned int ConflictGraph::noConflict;
 
 /**
  * @brief ConflictGraph::ConflictGraph()
- * @params DrawableDcel* dcel, const std::vector<Dcel::Vertex*> &remainingVertices
- *         Both std::tr1::unordered_set and map are used because they are faster that normal std::map and std::set.
- *         Also, we don't need to keep the order inside our maps and sets, so, we can use unordered sets/maps.
+ * @params HullMesh* hullMesh mesh of the hull being built, const std::vector<double> &coordinates packed xyz of the remaining vertices, they must outlive the conflict graph,
+ *         FacePlanes* facePlanes planes of the faces, used by the visibility test,
+ *         ScratchArena* scratchArena where the temporaries of each insertion are kept,
+ *         HullStatistics* hullStatistics where the visibility tests and the changes of the graph are counted,
+ *         unsigned int const &numberOfThreads maximum number of threads used to classify the vertices (at least 1)
+ *         The Conflict Graph is stored Clarkson-Shor style with flat arrays instead of hash maps:
+ *         - each remaining vertex, identified by its 32 bit index in coordinates, stores the id of only one face it is in conflict with
+ *         - each face, identified by its index in the mesh, owns a contiguous list of the indices of the vertices pointing to it
+ *         All the faces visible by a vertex are recovered walking the mesh starting from its only conflicting face.
  */
-ConflictGraph::ConflictGraph(DrawableDcel* dcel, const std::vector<Dcel::Vertex*> &remainingVertices){
-    this->dcel = dcel;
-    this->remainingVertices = remainingVertices;
+ConflictGraph::ConflictGraph(HullMesh* hullMesh, const std::vector<double> &coordinates, FacePlanes* facePlanes, ScratchArena* scratchArena, HullStatistics* hullStatistics, unsigned int const &numberOfThreads){
+    this->hullMesh = hullMesh;
+    this->facePlanes = facePlanes;
+    this->scratchArena = scratchArena;
+    this->hullStatistics = hullStatistics;
+    this->coordinates = coordinates.data();
+    this->verticesNumber = coordinates.size() / 3;
+    this->numberOfThreads = numberOfThreads > 0 ? numberOfThreads : 1;
+    this->trackFarthest = false;
+    this->vertexConflicts.assign(verticesNumber, noConflict);
 }
 
 /**
  * @brief ConflictGraph Class Destructor
  **/
 ConflictGraph::~ConflictGraph(){
-    faceConflictMap.clear();
-    vertexConflictMap.clear();
+    vertexConflicts.clear();
+    faceConflicts.clear();
 }
 
 /**
  * @brief ConflictGraph::initializeConflictGraph() initializes the conflict graph
+ *        Each remaining vertex is tested against the faces of the mesh until the first one
+ *        in conflict with it is found (see distributeVertices).
  */
 void ConflictGraph::initializeConflictGraph(){
 
-    //Number of Remaining vertices
-    int verticesNumber = remainingVertices.size();
+    //Faces of the mesh (the tetrahedron)
+    std::vector<unsigned int> faces = getFaces();
 
-    //For each face in the dcel
-    for(auto faceIterator = dcel->faceBegin(); faceIterator != dcel->faceEnd(); ++faceIterator){
+    //All the remaining vertices are candidates
+    std::vector<unsigned int> vertexIndices(verticesNumber);
+    for(unsigned int i = 0; i < vertexIndices.size(); i++){
+        vertexIndices[i] = i;
+    }
 
-        //For Each Remaining Vertex
-        for(int i = 0; i < verticesNumber; i++){
-            Dcel::Vertex* currVertex = remainingVertices[i];
-            //Check if they lie on the same half-space
-            halfSpaceChecker(*faceIterator, currVertex);
-        }
+    distributeVertices(faces, vertexIndices);
+}
+
+/**
+ * @brief ConflictGraph::addVertices(const std::vector<double> &coordinates, unsigned int const &firstVertex)
+ *        Called when the hull is finished and the packed coordinates have been changed by the builder:
+ *        the vertices before firstVertex are all on or inside the hull and are not in conflict anymore,
+ *        the ones from firstVertex on are new and are linked to the first face of the hull in conflict with them.
+ *        The arrays of the graph are sized again on the new coordinates, so the memory taken by the vertices
+ *        dropped from them is released.
+ * @param const std::vector<double> &coordinates packed xyz of the vertices, unsigned int const &firstVertex first new vertex
+ */
+void ConflictGraph::addVertices(const std::vector<double> &coordinates, unsigned int const &firstVertex){
+    this->coordinates = coordinates.data();
+    this->verticesNumber = coordinates.size() / 3;
+    std::vector<unsigned int>(verticesNumber, noConflict).swap(vertexConflicts);
+
+    //Vertices have been renumbered, the entries of the heap refer to the old indices
+    std::priority_queue<FarthestVertex>().swap(farthestVertices);
+
+    //Lists are all empty once the hull is finished, their capacity only depends on past insertions
+    for(auto listIterator = faceConflicts.begin(); listIterator != faceConflicts.end(); listIterator++){
+        std::vector<unsigned int>().swap(*listIterator);
+    }
 
+    //Faces of the current hull
+    std::vector<unsigned int> faces = getFaces();
+
+    //Only the new vertices are candidates
+    std::vector<unsigned int> vertexIndices;
+    vertexIndices.reserve(verticesNumber - std::min(firstVertex, verticesNumber));
+    for(unsigned int i = firstVertex; i < verticesNumber; i++){
+        vertexIndices.push_back(i);
+    }
+
+    distributeVertices(faces, vertexIndices);
+
+    //The faces with new vertices in conflict get their farthest one
+    if( trackFarthest ){
+        for(auto faceIterator = faces.begin(); faceIterator != faces.end(); faceIterator++){
+            pushFarthestVertex(*faceIterator);
+        }
     }
 }
 
+/**
+ * @brief ConflictGraph::getFaces() const
+ * @return std::vector<unsigned int> the faces of the mesh which are not deleted
+ */
+std::vector<unsigned int> ConflictGraph::getFaces() const{
+    std::vector<unsigned int> faces;
+    faces.reserve(hullMesh->getNumberFaces());
+    for(unsigned int face = 0; face < hullMesh->getFaceCapacity(); face++){
+        if( !hullMesh->isDeleted(face) ){
+            faces.push_back(face);
+        }
+    }
+    return faces;
+}
 
 /**
- * @brief ConflictGraph::halfSpaceChecker(Dcel::Face* face, Dcel::Vertex* vertex)
- *        Since all the vertices of a face lie on the same plain, we take one of them, for instance, the first
- *        and calculate the difference between it and the passed vertex to get checked.
- *        Then, we calculate all the arguments of the normal to the face and set them as coordinates to the normal itselfs.
- *        Then we calculate the dot product between the latter vertex and the normal.
- *        - If the dot product is > epsilon (in order to avoid floating point errors) then the vertex and the face
- *          lie on the very same half-space, implying that the vertex is in front of the face
- *        - Else we don't care because it means that they are not on the same half-space.
- * @param Dcel::Face* const &face, Dcel::Vertex* const &vertex
+ * @brief ConflictGraph::distributeVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices)
+ *        Links each passed vertex to the first of the passed faces in conflict with it, if any.
+ *        The vertices are split in contiguous ranges, one per thread. Each thread writes only the
+ *        conflicting face of its own vertices and fills its own per-face lists, so threads never share
+ *        a container. The lists are then appended to the conflict graph in range order, which gives the
+ *        very same lists of the single-threaded pass.
+ * @param std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices
  */
-void ConflictGraph::halfSpaceChecker(Dcel::Face* face, Dcel::Vertex* vertex){
-    //Array to contain all the vertices of the face
-    std::vector<Dcel::Vertex*> faceVertices;
-    //Initialize faceNormal
-    Dcel::Vertex* faceNormal = new Dcel::Vertex;
-    //For each Vertex in the face
-    for( auto vertexIterator = face->incidentVertexBegin(); vertexIterator != face->incidentVertexEnd(); vertexIterator++ ){
-        //Add it to the array
-        faceVertices.push_back(*vertexIterator);
+void ConflictGraph::distributeVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices){
+
+    unsigned int verticesNumber = vertexIndices.size();
+
+    //Do not spawn threads for few vertices, it costs more than the test itself
+    const unsigned int minVerticesPerThread = 16384;
+    unsigned int threadsNumber = std::min(numberOfThreads, std::max(1u, verticesNumber / minVerticesPerThread));
+
+    //Single thread, vertices are added straight to the conflict graph
+    if( threadsNumber == 1 ){
+        for(auto vertexIterator = vertexIndices.begin(); vertexIterator != vertexIndices.end(); vertexIterator++){
+            unsigned int f = findConflict(faces, *vertexIterator);
+            if( f < faces.size() ){
+                addConflict(faces[f], *vertexIterator);
+                hullStatistics->halfSpaceChecks += f + 1;
+                hullStatistics->conflictInserts++;
+            } else {
+                hullStatistics->halfSpaceChecks += f;
+            }
+        }
+        return;
+    }
+
+    //For each thread, for each face, the vertices of the thread's range in conflict with the face
+    std::vector< std::vector< std::vector<unsigned int> > > threadConflicts(threadsNumber, std::vector< std::vector<unsigned int> >(faces.size()));
+    //Visibility tests of each thread, added to the counters after the join
+    std::vector<unsigned long long> threadChecks(threadsNumber, 0);
+
+    //Spawn threads for all the ranges but the first one, which is classified by the current thread
+    std::vector<std::thread> threads;
+    for(unsigned int t = 1; t < threadsNumber; t++){
+        unsigned int begin = (unsigned long long) verticesNumber * t / threadsNumber;
+        unsigned int end   = (unsigned long long) verticesNumber * (t+1) / threadsNumber;
+        threads.push_back(std::thread(&ConflictGraph::classifyVertices, this, std::cref(faces), std::cref(vertexIndices), begin, end, std::ref(threadConflicts[t]), std::ref(threadChecks[t])));
+    }
+    classifyVertices(faces, vertexIndices, 0, verticesNumber / threadsNumber, threadConflicts[0], threadChecks[0]);
+    for(auto threadIterator = threads.begin(); threadIterator != threads.end(); threadIterator++){
+        threadIterator->join();
     }
 
-    //Getting Temp vector
-    auto tmpVector = vertex->getCoordinate() - faceVertices[0]->getCoordinate();
-
-    //Getting Face Arguments per each coordinate
-    auto a = (
-                ((faceVertices[1]->getCoordinate().y() - faceVertices[0]->getCoordinate().y())*(faceVertices[2]->getCoordinate().z()-faceVertices[0]->getCoordinate().z()))-
-            ((faceVertices[2]->getCoordinate().y() - faceVertices[0]->getCoordinate().y())*(faceVertices[1]->getCoordinate().z()-faceVertices[0]->getCoordinate().z()))
-            );
-
-    auto b = (
-                ((faceVertices[1]->getCoordinate().z() - faceVertices[0]->getCoordinate().z())*(faceVertices[2]->getCoordinate().x()-faceVertices[0]->getCoordinate().x()))-
-            ((faceVertices[2]->getCoordinate().z() - faceVertices[0]->getCoordinate().z())*(faceVertices[1]->getCoordinate().x()-faceVertices[0]->getCoordinate().x()))
-            );
-
-    auto c = (
-                ((faceVertices[1]->getCoordinate().x() - faceVertices[0]->getCoordinate().x())*(faceVertices[2]->getCoordinate().y()-faceVertices[0]->getCoordinate().y()))-
-            ((faceVertices[2]->getCoordinate().x() - faceVertices[0]->getCoordinate().x())*(faceVertices[1]->getCoordinate().y()-faceVertices[0]->getCoordinate().y()))
-            );
-
-    //Setting faceNormal coordinates
-    faceNormal->setCoordinate(Pointd(a, b, c));
-
-    //Calculate Dot Product
-    auto dotProduct = tmpVector.dot(faceNormal->getCoordinate());
-
-    //If dotProduct > epsilon
-    if( dotProduct > std::numeric_limits<double>::epsilon() ){
-        /* Current vertex and current face lie on the same half-space, implying
-         * that the vertex is in front of the face, so they are in conflict */
-        addToVertexConflictMap(face, vertex);
-        addToFaceConflictMap  (face, vertex);
+    //Merge the lists of each thread
+    for(unsigned int f = 0; f < faces.size(); f++){
+        std::vector<unsigned int> &verticesInConflict = getVerticesVisibleByFace(faces[f]);
+        for(unsigned int t = 0; t < threadsNumber; t++){
+            verticesInConflict.insert(verticesInConflict.end(), threadConflicts[t][f].begin(), threadConflicts[t][f].end());
+            hullStatistics->conflictInserts += threadConflicts[t][f].size();
+        }
+    }
+    for(unsigned int t = 0; t < threadsNumber; t++){
+        hullStatistics->halfSpaceChecks += threadChecks[t];
     }
 }
 
 /**
- * @brief addToVertexConflictMap(Dcel::Face* face, Dcel::Vertex* vertex) *
- *        checks if, for that face, the map exists for that key entry,
- *        if not, a new set is created then, in any case, passed vertex is inserted into it
- *        at face's position
- * @param Dcel::Face* const &face, Dcel::Vertex* const &vertex
+ * @brief ConflictGraph::classifyVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices,
+ *                                        unsigned int const &begin, unsigned int const &end, std::vector< std::vector<unsigned int> > &conflicts,
+ *                                        unsigned long long &halfSpaceChecks)
+ *        For each vertex in vertexIndices[begin, end) finds its conflicting face and appends the vertex to conflicts
+ *        at the face position. Only touches data owned by the range, so it can run concurrently on disjoint ranges.
+ * @param std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices,
+ *        unsigned int const &begin, unsigned int const &end, std::vector< std::vector<unsigned int> > &conflicts,
+ *        unsigned long long &halfSpaceChecks incremented by the number of visibility tests done
  */
-void ConflictGraph::addToVertexConflictMap(Dcel::Face* face, Dcel::Vertex* vertex) {
-    //If at current face's position there's nothing
-    if( this->vertexConflictMap[face] == nullptr ){
-        //Initialize a new unordered_set of vertices and assign it to face's position
-        this->vertexConflictMap[face] = new std::tr1::unordered_set<Dcel::Vertex*>;
+void ConflictGraph::classifyVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices,
+                                     unsigned int const &begin, unsigned int const &end, std::vector< std::vector<unsigned int> > &conflicts,
+                                     unsigned long long &halfSpaceChecks){
+    //For Each Vertex in the range
+    for(unsigned int i = begin; i < end; i++){
+        unsigned int f = findConflict(faces, vertexIndices[i]);
+        if( f < faces.size() ){
+            vertexConflicts[vertexIndices[i]] = faces[f];
+            conflicts[f].push_back(vertexIndices[i]);
+            halfSpaceChecks += f + 1;
+        } else {
+            halfSpaceChecks += f;
+        }
     }
-    //In any case, Insert the current vertex in it
-    this->vertexConflictMap[face]->insert(vertex);
 }
 
 /**
- * @brief addToFaceConflictMap(Dcel::Face* face, Dcel::Vertex* vertex)
- *        checks if, for that vertex, the map exists for that key entry,
- *        if not, a new set is created then, in any case, passed face is inserted into it
- *        at vertex's position
- * @param Dcel::Face* const &face, Dcel::Vertex* const &vertex
+ * @brief ConflictGraph::findConflict(std::vector<unsigned int> const &faces, unsigned int const &vertexIndex)
+ *        Looks for the first of the passed faces in conflict with the vertex.
+ *        The vertex is no longer linked to any face, the caller links it to the one found.
+ * @param std::vector<unsigned int> const &faces, unsigned int const &vertexIndex
+ * @return unsigned int position in faces of the conflicting face, faces.size() if the vertex is behind all the faces
  */
-void ConflictGraph::addToFaceConflictMap(Dcel::Face* face, Dcel::Vertex* vertex) {
-    //If at current vertex's position there's nothing
-    if( this->faceConflictMap[vertex] == nullptr ){
-        //Initialize a new unordered_set of faces and assign it to vertex's position
-        this->faceConflictMap[vertex] = new std::tr1::unordered_set<Dcel::Face*>;
+unsigned int ConflictGraph::findConflict(std::vector<unsigned int> const &faces, unsigned int const &vertexIndex){
+    //The vertex is not in conflict until a face in front of it is found
+    vertexConflicts[vertexIndex] = noConflict;
+
+    //For each face
+    unsigned int facesNumber = faces.size();
+    for(unsigned int f = 0; f < facesNumber; f++){
+        //Check if they lie on the same half-space, the first face found is enough
+        if( halfSpaceChecker(faces[f], vertexIndex) ){
+            return f;
+        }
     }
-    //In any case, Insert the current face in it
-    this->faceConflictMap[vertex]->insert(face);
+    return facesNumber;
 }
 
 /**
- * @brief  getFacesVisibleByVertex(Dcel::Vertex* &currentVertex)
- *         Checks if passed vertex is in conflict with dcel's faces and if it indeed is in conflict,
- *         return set of faces visible by it
- * @param  Dcel::Vertex* const &currentVertex
- * @return std::tr1::unordered_set<Dcel::Face*> set of faces visible by the vertex
+ * @brief ConflictGraph::halfSpaceChecker(unsigned int const &face, unsigned int const &vertexIndex)
+ *        Checks if the vertex and the face lie on the same half-space, implying that the vertex is in front of the face.
+ *        The plane of the face has been computed once when the face was created, so the test is a single
+ *        dot product against the cached normal and offset (see FacePlanes::isVisible), read straight from the packed coordinates.
+ * @param unsigned int const &face, unsigned int const &vertexIndex
+ * @return true if the vertex is in front of the face, so they are in conflict
  */
-std::tr1::unordered_set<Dcel::Face*>* ConflictGraph::getFacesVisibleByVertex(Dcel::Vertex* &currentVertex){
+bool ConflictGraph::halfSpaceChecker(unsigned int const &face, unsigned int const &vertexIndex) const{
+    return facePlanes->isVisible(face, coordinates + vertexIndex * 3);
+}
 
-    //Check if the vertex is in conflict. If it is indeed, visible faces will not be nullptr
-    std::tr1::unordered_set<Dcel::Face*>* visibleFaces = this->faceConflictMap[currentVertex];
+/**
+ * @brief ConflictGraph::addConflict(unsigned int const &face, unsigned int const &vertexIndex)
+ *        Sets the passed face as the only face in conflict with the vertex and appends
+ *        the vertex to the list of the face
+ * @param unsigned int const &face, unsigned int const &vertexIndex
+ */
+void ConflictGraph::addConflict(unsigned int const &face, unsigned int const &vertexIndex){
+    vertexConflicts[vertexIndex] = face;
+    getVerticesVisibleByFace(face).push_back(vertexIndex);
+}
 
-    //If the Vertex is not in conflict
-    if( visibleFaces == nullptr ){
-        //Build a new set and put it at vertex's position
-        visibleFaces = new std::tr1::unordered_set<Dcel::Face*>;
-        this->faceConflictMap[currentVertex] = visibleFaces;
+/**
+ * @brief  ConflictGraph::getVerticesVisibleByFace(unsigned int const &face)
+ *         Returns the list of the vertices in conflict with the passed face, the list is created
+ *         the first time a face is seen. Faces are recycled by the mesh, so are the lists.
+ * @param  unsigned int const &face
+ * @return std::vector<unsigned int>& indices of the vertices in conflict with the face
+ */
+std::vector<unsigned int>& ConflictGraph::getVerticesVisibleByFace(unsigned int const &face){
+    if( face >= faceConflicts.size() ){
+        faceConflicts.resize(face + 1);
     }
-
-    //Return a set of visible faces by the vertex
-    return new std::tr1::unordered_set<Dcel::Face*> (*visibleFaces);
+    return faceConflicts[face];
 }
 
 /**
-* @brief  joinVertices(std::vector<Dcel::HalfEdge*>* std::vector<Dcel::HalfEdge*> horizon)
-*         Merges the vertices that are in conflict with a given horizon halfedge face and twin's face
-*         in order to speed up the process of understanding which vertices are in conflict with the new faces
-*         to be added
-* @param  const std::vector<Dcel::HalfEdge*> &horizon) const
-* @return std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>> map that for each HalfEdge has the latter merged vertices
-*/
-std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> ConflictGraph::joinVertices( std::vector<Dcel::HalfEdge*> horizon){
-
-    //Initialize joined vertices map
-    std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> joinedVerticesMap;
-
-    //For each HalfEdge in the horizon
-    for(auto halfEdgeIterator = horizon.begin(); halfEdgeIterator != horizon.end(); halfEdgeIterator++){
-        //Get current HalfEdge's twin
-        Dcel::HalfEdge *currTwin=  (*halfEdgeIterator)->getTwin();
-        //Get its face
-        Dcel::Face *currentFace = (*halfEdgeIterator)->getFace();
-        //Get twin's face
-        Dcel::Face *twinsFace   = currTwin->getFace();
+ * @brief  ConflictGraph::getFacesVisibleByVertex(unsigned int const &vertexIndex)
+ *         Starting from the only face in conflict with the vertex, walks the mesh through the twins
+ *         of the halfedges and collects all the connected faces visible by the vertex.
+ *         Faces already tested are marked with their flag (1 visible, 2 not visible) so that each face
+ *         is tested at most once, flags of the not visible ones are reset at the end.
+ *         Visible faces keep flag 1 until they are deleted, so that the horizon can tell them apart.
+ *         The faces are in the order they are found, which only depends on the mesh,
+ *         so the same insertion order always gives the same hull.
+ * @param  unsigned int const &vertexIndex
+ * @return std::vector<unsigned int> const & faces visible by the vertex, empty if the vertex is inside the hull
+ */
+std::vector<unsigned int> const & ConflictGraph::getFacesVisibleByVertex(unsigned int const &vertexIndex){
 
-        //Get Vertices visible by the latter faces
-        std::tr1::unordered_set<Dcel::Vertex*> *verticesInConflictWithCurrFace  = getVerticesVisibleByFace(currentFace);
-        std::tr1::unordered_set<Dcel::Vertex*> *verticesInConflictWithTwinsFace = getVerticesVisibleByFace(twinsFace);
+    //Visible faces, the stack of faces to be visited and the faces found not visible come from the scratch arena
+    std::vector<unsigned int> &visibleFaces    = scratchArena->visibleFaces;
+    std::vector<unsigned int> &facesToVisit    = scratchArena->facesToVisit;
+    std::vector<unsigned int> &notVisibleFaces = scratchArena->notVisibleFaces;
 
-        //Join the two sets of vertices
-        verticesInConflictWithCurrFace->insert(verticesInConflictWithTwinsFace->begin(), verticesInConflictWithTwinsFace->end());
+    //If the Vertex is not in conflict, it is inside the hull
+    if( vertexConflicts[vertexIndex] == noConflict ){
+        return visibleFaces;
+    }
 
-        //Build the map with new vertices
-        joinedVerticesMap[*halfEdgeIterator] = verticesInConflictWithCurrFace;
+    //Get the only face in conflict with the vertex
+    unsigned int conflictFace = vertexConflicts[vertexIndex];
+
+    hullMesh->setFlag(conflictFace, 1);
+    visibleFaces.push_back(conflictFace);
+    facesToVisit.push_back(conflictFace);
+
+    while( !facesToVisit.empty() ){
+        unsigned int currFace = facesToVisit.back();
+        facesToVisit.pop_back();
+
+        //For each halfedge in the face, look at the face on the other side
+        unsigned int outerHalfEdge = HullMesh::getOuterHalfEdge(currFace);
+        for( unsigned int halfEdge = outerHalfEdge; halfEdge < outerHalfEdge + 3; halfEdge++ ){
+            unsigned int twinsFace = HullMesh::getFace(hullMesh->getTwin(halfEdge));
+
+            //If not tested yet
+            if( hullMesh->getFlag(twinsFace) == 0 ){
+                hullStatistics->halfSpaceChecks++;
+                if( halfSpaceChecker(twinsFace, vertexIndex) ){
+                    hullMesh->setFlag(twinsFace, 1);
+                    visibleFaces.push_back(twinsFace);
+                    facesToVisit.push_back(twinsFace);
+                } else {
+                    hullMesh->setFlag(twinsFace, 2);
+                    notVisibleFaces.push_back(twinsFace);
+                }
+            }
+        }
     }
 
-    //Return populated Map
-    return joinedVerticesMap;
+    //Reset flags of the not visible faces, visible faces are going to be deleted
+    for( auto faceIterator = notVisibleFaces.begin(); faceIterator != notVisibleFaces.end(); faceIterator++ ){
+        hullMesh->resetFlag(*faceIterator);
+    }
 
+    //Return the faces visible by the vertex
+    return visibleFaces;
 }
 
 /**
- * @brief  getVerticesVisibleByFace(Dcel::Face* currentFace)
- *         Check if passed face is in conflict with dcel's vertices and if it is, then,
- *         return set of vertices visible by it
- * @param  const Dcel::Face* &currentFace
- * @return std::tr1::unordered_set<Dcel::Vertex*>* set of vertices visible by the face
- */
-std::tr1::unordered_set<Dcel::Vertex*>* ConflictGraph::getVerticesVisibleByFace(Dcel::Face* currentFace){
-    //Check if the vertex is in conflict. If it is indeed, visible faces will not be nullptr
-    std::tr1::unordered_set<Dcel::Vertex*>* visibleVertices = this->vertexConflictMap[currentFace];
-
-    //If the Vertex is not in conflict
-    if( visibleVertices == nullptr ){
-        //Build a new set and associate put it at face's position
-        visibleVertices = new std::tr1::unordered_set<Dcel::Vertex*>;
-        this->vertexConflictMap[currentFace] = visibleVertices;
-    }
+* @brief  joinVertices(std::vector<unsigned int> const &visibleFaces, unsigned int const &currentVertexIndex) const
+*         Merges the vertices that are in conflict with the faces visible by the current vertex.
+*         These are the only vertices that can be in conflict with the new faces to be added:
+*         a vertex which was in front of a deleted face and is still outside the new hull, is in front of a new face.
+* @param  std::vector<unsigned int> const &visibleFaces, unsigned int const &currentVertexIndex
+* @return std::vector<unsigned int> const & indices of the candidate vertices, the current vertex excluded, kept in the scratch arena
+*/
+std::vector<unsigned int> const & ConflictGraph::joinVertices(std::vector<unsigned int> const &visibleFaces, unsigned int const &currentVertexIndex) const{
 
-    //Return a set of visible vertices by the face
-    return new std::tr1::unordered_set<Dcel::Vertex*> (*visibleVertices);
+    //Candidate vertices come from the scratch arena
+    std::vector<unsigned int> &candidateVertices = scratchArena->candidateVertices;
 
+    //For each visible face
+    for( auto faceIterator = visibleFaces.begin(); faceIterator != visibleFaces.end(); faceIterator++ ){
+        if( *faceIterator < faceConflicts.size() ){
+            const std::vector<unsigned int> &verticesInConflict = faceConflicts[*faceIterator];
+            for( auto vertexIterator = verticesInConflict.begin(); vertexIterator != verticesInConflict.end(); vertexIterator++ ){
+                if( *vertexIterator != currentVertexIndex ){
+                    candidateVertices.push_back(*vertexIterator);
+                }
+            }
+        }
+    }
+
+    //Return candidate vertices
+    return candidateVertices;
 }
 
 /**
- * @brief  deleteFaces(std::tr1::unordered_set<Dcel::Face*>* visibleFaces)
- *         Deletes all the visible faces by the current vertex from the Conflict Graph,
- *         Removes their Halfedges from the dcel and their vertices if there are no more
- *         Connecting Halfedges between a From and a To Vertex
- * @param  std::tr1::unordered_set<Dcel::Face*>* visibleFaces set of visible faces by current vertex
+ * @brief  deleteFaces(std::vector<unsigned int> const &visibleFaces)
+ *         Deletes all the visible faces by the current vertex from the Conflict Graph and from the mesh.
+ *         The vertices of the mesh are the indices of the points, so there is nothing else to delete.
+ * @param  std::vector<unsigned int> const &visibleFaces faces visible by current vertex
  */
-void ConflictGraph::deleteFaces(std::tr1::unordered_set<Dcel::Face*>* visibleFaces){
-    //Loop through all the faces
-    for( auto faceIterator = visibleFaces->begin(); faceIterator != visibleFaces->end(); faceIterator++ ){
-
-        //Get Current Face
-        Dcel::Face* currFace = *faceIterator;
-
-        /** Delete from Conflict Graph Begin **/
-        //Get All the Vertices visible by the current face
-        std::tr1::unordered_set<Dcel::Vertex*> *verticesVisibleByFace = getVerticesVisibleByFace(currFace);
-        //If there are visible vertices indeed
-        if( verticesVisibleByFace != nullptr ){
-            //Delete current Face From the vertexConflictMap
-            this->vertexConflictMap.erase(currFace);
-            //For each visible vertex
-            for( auto currVisibleVertex = verticesVisibleByFace->begin(); currVisibleVertex != verticesVisibleByFace->end(); currVisibleVertex++ ){
-                //Get Current Visible Vertex
-                Dcel::Vertex* currVertex = *currVisibleVertex;
-                //Delete current face at current vertex's position in faceConflictMap
-                this->faceConflictMap[currVertex]->erase(currFace);
-            }
-        }
-        /** Delete from Conflict Graph End **/
+void ConflictGraph::deleteFaces(std::vector<unsigned int> const &visibleFaces){
+    hullStatistics->facesDeleted += visibleFaces.size();
 
-        /** Delete from Dcel Begin **/
-        //For each halfedge in the face
-        for( auto halfEdgeIterator = (*faceIterator)->incidentHalfEdgeBegin(); halfEdgeIterator != (*faceIterator)->incidentHalfEdgeEnd(); halfEdgeIterator++ ){
+    //Loop through all the faces
+    for( auto faceIterator = visibleFaces.begin(); faceIterator != visibleFaces.end(); faceIterator++ ){
 
-            //Get Current HalfEdge
-            Dcel::HalfEdge* currHalfEdge = *halfEdgeIterator;
+        //Vertices of the list have been moved to the candidates by joinVertices, the list is kept for the next face with this id
+        std::vector<unsigned int> &verticesInConflict = getVerticesVisibleByFace(*faceIterator);
+        hullStatistics->conflictErases += verticesInConflict.size();
+        verticesInConflict.clear();
 
-            //Get its From and To Vertex
-            Dcel::Vertex* fromVertex = currHalfEdge->getFromVertex();
-            Dcel::Vertex* toVertex   = currHalfEdge->getToVertex();
+        //The entries of the heap pushed for this face become stale, even after its id is reused
+        if( *faceIterator >= faceGenerations.size() ){
+            faceGenerations.resize(*faceIterator + 1, 0);
+        }
+        faceGenerations[*faceIterator]++;
 
-            //Remove The HalfEdge from The Dcel
-            this->dcel->deleteHalfEdge(currHalfEdge);
+        //The slot of the face is reused by the next new face
+        hullMesh->deleteFace(*faceIterator);
+    }
+}
 
-            //Decrement its From and To Vertices Cardinalities since we have removed an HalfEdge
-            fromVertex->decrementCardinality();
-            toVertex  ->decrementCardinality();
+/**
+ * @brief  ConflictGraph::checkConflict(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &candidateVertices)
+ *         For each candidate vertex, looks for the first new face in conflict with it.
+ *         If there is none, the vertex is now inside the hull and it is no longer in the conflict graph.
+ *         Large candidate sets are classified by several threads (see distributeVertices).
+ * @param  std::vector<unsigned int> const &faces, std::vector<unsigned int> const &candidateVertices
+ */
+void ConflictGraph::checkConflict(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &candidateVertices){
+    distributeVertices(faces, candidateVertices);
 
-            //When Cardinality is 0, it means that the Vertex Has no connections, so, we can safely remove it
-            if( fromVertex->getCardinality() == 0 ){
-                this->dcel->deleteVertex(fromVertex);
-            }
-            if( toVertex->getCardinality() == 0 ){
-                this->dcel->deleteVertex(toVertex);
-            }
+    //Each new face with a non empty conflict list gets its farthest vertex
+    if( trackFarthest ){
+        for(auto faceIterator = faces.begin(); faceIterator != faces.end(); faceIterator++){
+            pushFarthestVertex(*faceIterator);
         }
+    }
+}
 
-        //Delete the current face to close the loop
-        this->dcel->deleteFace(currFace);
+/**
+ * @brief  ConflictGraph::eraseVertex(unsigned int const &vertexIndex)
+ *         Delete Current Vertex from the conflict Graph.
+ *         Its conflicting face, if any, has been deleted with its list, so only the vertex side is reset.
+ * @param  unsigned int const &vertexIndex
+ */
+void ConflictGraph::eraseVertex(unsigned int const &vertexIndex){
+    vertexConflicts[vertexIndex] = noConflict;
+}
 
-        /** Delete from Dcel End   **/
+/**
+ * @brief  ConflictGraph::trackFarthestVertices()
+ *         From now on, keeps track of the farthest vertex in conflict with each face,
+ *         starting from the faces currently in the mesh. Used by the Quickhull strategy.
+ */
+void ConflictGraph::trackFarthestVertices(){
+    trackFarthest = true;
+    for(unsigned int face = 0; face < hullMesh->getFaceCapacity(); face++){
+        if( !hullMesh->isDeleted(face) ){
+            pushFarthestVertex(face);
+        }
     }
 }
 
 /**
- * @brief  ConflictGraph::checkConflict(std::vector<Dcel::Face*> faces, std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> oldVertices, std::vector<Dcel::HalfEdge*> horizon)
- *         For each new Face, check if they are in conflict with the old vertices from the latter destroyed face
- * @param  std::vector<Dcel::Face*> faces, std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> oldVertices, std::vector<Dcel::HalfEdge*> horizon
+ * @brief  ConflictGraph::nextFarthestVertex(unsigned int &vertexIndex)
+ *         Pops the vertex farthest from its conflicting face among all the faces of the hull.
+ *         Entries whose face has been deleted, even if its id has been reused by a new face, or whose vertex has been
+ *         erased or linked to another face meanwhile are skipped: the distance of the entries left is still current.
+ * @param  unsigned int &vertexIndex, set to the index of the farthest vertex
+ * @return false if no vertex is outside the current hull
  */
-void ConflictGraph::checkConflict(std::vector<Dcel::Face*> faces, std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> oldVertices, std::vector<Dcel::HalfEdge*> horizon){
-    //For each face in faces
-    for( auto faceIterator = faces.begin(); faceIterator != faces.end(); faceIterator++){
-        //For each halfedge in the horizon
-        for( auto halfEdgeIterator = horizon.begin(); halfEdgeIterator != horizon.end(); halfEdgeIterator++){
-            //Get Set Of vertices associated to the current horizon halfEdge
-            std::tr1::unordered_set<Dcel::Vertex*> *currVertexSet = oldVertices[*halfEdgeIterator];
-            //For each vertex in the possible conflict ones
-            for( auto vertexIterator = currVertexSet->begin(); vertexIterator != currVertexSet->end(); vertexIterator++ ){
-                //Check if they lie on the same half-space, if so, update the Conflict Graph
-                halfSpaceChecker(*faceIterator, *vertexIterator);
-            }
+bool ConflictGraph::nextFarthestVertex(unsigned int &vertexIndex){
+    while( !farthestVertices.empty() ){
+        FarthestVertex farthest = farthestVertices.top();
+        farthestVertices.pop();
+        unsigned int faceGeneration = farthest.faceId < faceGenerations.size() ? faceGenerations[farthest.faceId] : 0;
+        if( farthest.faceGeneration == faceGeneration && vertexConflicts[farthest.vertexIndex] == farthest.faceId ){
+            vertexIndex = farthest.vertexIndex;
+            return true;
         }
     }
+    return false;
 }
 
 /**
- * @brief  ConflictGraph::eraseVertex(Dcel::Vertex* vertex)
- *         Delete Current Vertex from the conflict Graph
- * @param  Dcel::Vertex* vertex
+ * @brief  ConflictGraph::pushFarthestVertex(unsigned int const &face)
+ *         Looks for the vertex farthest from the face among the ones in conflict with it and pushes it in the heap
+ * @param  unsigned int const &face
  */
-void ConflictGraph::eraseVertex(Dcel::Vertex* vertex){
-    //Get All Visible Faces by the passed Vertex
-    std::tr1::unordered_set<Dcel::Face*> *visibleFaces = getFacesVisibleByVertex(vertex);
-
-    //Remove it from the faceConflictMap
-    this->faceConflictMap.erase(vertex);
-
-    //For each visible face
-    for( auto faceIterator = visibleFaces->begin(); faceIterator != visibleFaces->end(); faceIterator++ ){
-        //Delete the vertex from vertexConflictMap for each face which was in conflict with it
-        this->vertexConflictMap[(*faceIterator)]->erase(vertex);
+void ConflictGraph::pushFarthestVertex(unsigned int const &face){
+    std::vector<unsigned int> &verticesInConflict = getVerticesVisibleByFace(face);
+    if( verticesInConflict.empty() ){
+        return;
     }
 
+    FarthestVertex farthest;
+    farthest.distance = -1;
+    farthest.faceId = face;
+    farthest.faceGeneration = face < faceGenerations.size() ? faceGenerations[face] : 0;
+    for(auto vertexIterator = verticesInConflict.begin(); vertexIterator != verticesInConflict.end(); vertexIterator++){
+        double distance = facePlanes->distance(face, coordinates + *vertexIterator * 3);
+        if( distance > farthest.distance ){
+            farthest.distance = distance;
+            farthest.vertexIndex = *vertexIterator;
+        }
+    }
+    farthestVertices.push(farthest);
 }
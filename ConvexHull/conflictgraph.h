@@ -1,33 +1,75 @@
 #ifndef CONFLICTGRAPH_H
 #define CONFLICTGRAPH_H
 
-#include <tr1/unordered_set>
-#include <tr1/unordered_map>
-#include "lib/dcel/drawable_dcel.h"
+#include <queue>
+#include <thread>
+#include "hullmesh.h"
+#include "faceplanes.h"
+#include "scratcharena.h"
+#include "hullstatistics.h"
 
 class ConflictGraph{
 
 public:
-    ConflictGraph(DrawableDcel* dcel, const std::vector<Dcel::Vertex*> &remainingVertices); // Class Constructor
+    ConflictGraph(HullMesh* hullMesh, const std::vector<double> &coordinates, FacePlanes* facePlanes, ScratchArena* scratchArena, HullStatistics* hullStatistics, unsigned int const &numberOfThreads = 1); // Class Constructor
     ~ConflictGraph(); //Destructor Declaration
     void initializeConflictGraph();
+    void addVertices(const std::vector<double> &coordinates, unsigned int const &firstVertex);
 
-    std::tr1::unordered_set<Dcel::Face*>* getFacesVisibleByVertex (Dcel::Vertex* &currentVertex);
-    std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> joinVertices(std::vector<Dcel::HalfEdge*> horizon);
-    void deleteFaces(std::tr1::unordered_set<Dcel::Face*>*);
-    void checkConflict(std::vector<Dcel::Face*>, std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*>, std::vector<Dcel::HalfEdge*>);
-    void eraseVertex(Dcel::Vertex*);
-
-    std::tr1::unordered_map<Dcel::Face*,   std::tr1::unordered_set<Dcel::Vertex*>*> vertexConflictMap;
-    std::tr1::unordered_map<Dcel::Vertex*, std::tr1::unordered_set<Dcel::Face*>*>   faceConflictMap;
+    std::vector<unsigned int> const & getFacesVisibleByVertex(unsigned int const &vertexIndex);
+    std::vector<unsigned int> const & joinVertices(std::vector<unsigned int> const &visibleFaces, unsigned int const &currentVertexIndex) const;
+    void deleteFaces(std::vector<unsigned int> const &visibleFaces);
+    void checkConflict(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &candidateVertices);
+    void eraseVertex(unsigned int const &vertexIndex);
+    void trackFarthestVertices();
+    bool nextFarthestVertex(unsigned int &vertexIndex);
 
 private:
-    DrawableDcel *dcel;
-    std::vector<Dcel::Vertex*> remainingVertices;
-    void halfSpaceChecker(Dcel::Face* face, Dcel::Vertex* vertex);
-    void addToFaceConflictMap(Dcel::Face* face, Dcel::Vertex* vertex);
-    void addToVertexConflictMap(Dcel::Face* face, Dcel::Vertex* vertex);
-    std::tr1::unordered_set<Dcel::Vertex*>* getVerticesVisibleByFace(Dcel::Face* currentFace);
+    HullMesh *hullMesh;
+    FacePlanes *facePlanes;
+    /** Temporaries of the current insertion, owned by ConvexHullBuilder **/
+    ScratchArena *scratchArena;
+    /** Counters of the builder, owned by ConvexHullBuilder **/
+    HullStatistics *hullStatistics;
+    /** Packed xyz of the remaining vertices, owned by ConvexHullBuilder: vertex i is at coordinates[3*i] **/
+    const double *coordinates;
+    unsigned int verticesNumber;
+    unsigned int numberOfThreads;
+
+    /** Face id stored for the vertices which are not in conflict with any face **/
+    static const unsigned int noConflict = HullMesh::noIndex;
+    /** For each remaining vertex, the id of the only face it is in conflict with,
+     *  noConflict if the vertex is inside the current hull **/
+    std::vector<unsigned int> vertexConflicts;
+    /** For each face id, the contiguous list of indices of the remaining vertices in conflict with the face **/
+    std::vector< std::vector<unsigned int> > faceConflicts;
+
+    /** For each face id, how many times a face with that id has been deleted **/
+    std::vector<unsigned int> faceGenerations;
+
+    /** Farthest vertex in conflict with a face, as it was when the face got its conflict list **/
+    struct FarthestVertex{
+        double distance;
+        unsigned int faceId;
+        unsigned int faceGeneration;
+        unsigned int vertexIndex;
+        bool operator<(FarthestVertex const &other) const { return distance < other.distance; }
+    };
+    /** Max-heap of the farthest vertex of each face, only filled if trackFarthestVertices() has been called.
+     *  Entries are not removed when faces are deleted, they are discarded when popped (see nextFarthestVertex) **/
+    std::priority_queue<FarthestVertex> farthestVertices;
+    bool trackFarthest;
+
+    std::vector<unsigned int> getFaces() const;
+    bool halfSpaceChecker(unsigned int const &face, unsigned int const &vertexIndex) const;
+    void addConflict(unsigned int const &face, unsigned int const &vertexIndex);
+    std::vector<unsigned int>& getVerticesVisibleByFace(unsigned int const &face);
+    void distributeVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices);
+    void classifyVertices(std::vector<unsigned int> const &faces, std::vector<unsigned int> const &vertexIndices,
+                          unsigned int const &begin, unsigned int const &end, std::vector< std::vector<unsigned int> > &conflicts,
+                          unsigned long long &halfSpaceChecks);
+    void pushFarthestVertex(unsigned int const &face);
+    unsigned int findConflict(std::vector<unsigned int> const &faces, unsigned int const &vertexIndex);
 
 };
 
@@ -0,0 +1,87 @@
+# Convex Hull Builder Benchmark: times the builder on the models and on generated clouds, headless like convexhull_cli.
+# QtCore/QtGui are still needed by the Dcel library (QColor, QDebug), but no display is required.
+
+QT += core gui
+QT -= widgets opengl
+
+TARGET = convexhull_bench
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+CONFIG(debug, debug|release){
+    message(debug)
+    DEFINES += DEBUG
+}
+
+unix:!macx{
+    LIBS += -frounding-math -lgmp -lCGAL -pthread
+    LIBS+=/usr/lib/libboost_system.so.1.62.0
+
+
+    DEFINES += CGAL_DEFINED
+    QMAKE_CXXFLAGS += -std=c++11 -g -pthread
+}
+
+macx{
+    CONFIG += c++11
+    DEFINES += CGAL_DEFINED
+    INCLUDEPATH += -I /libs/include/boost/
+    INCLUDEPATH += -I /libs/include/CGAL/
+    LIBS += -frounding-math
+    LIBS += -L/libs/lib/gmp -lgmp
+    LIBS += -L/libs/lib/CGAL -lCGAL
+}
+
+HEADERS += \
+    lib/common/bounding_box.h \
+    lib/common/comparators.h \
+    lib/common/point.h \
+    lib/dcel/dcel.h \
+    lib/dcel/dcel_face.h \
+    lib/dcel/dcel_face_iterators.h \
+    lib/dcel/dcel_half_edge.h \
+    lib/dcel/dcel_iterators.h \
+    lib/dcel/dcel_struct.h \
+    lib/dcel/dcel_vertex.h \
+    lib/dcel/dcel_vertex_iterators.h \
+    lib/dcel/dcel_pool.h \
+    lib/common/common.h \
+    lib/common/serialize.h \
+    lib/common/timer.h \
+    convexhullbuilder.h \
+    conflictgraph.h \
+    tetrahedronbuilder.h \
+    facebuilderhelper.h \
+    convexhullbuilderhelper.h \
+    convexhullobserver.h \
+    faceplanes.h \
+    parallelconvexhullbuilder.h \
+    extremepointsfilter.h \
+    predicates.h \
+    scratcharena.h \
+    hullmesh.h \
+    hullstatistics.h \
+    streamingconvexhullbuilder.h
+
+SOURCES += \
+    lib/dcel/dcel_face.cpp \
+    lib/dcel/dcel_half_edge.cpp \
+    lib/dcel/dcel_vertex.cpp \
+    lib/dcel/dcel_struct.cpp \
+    convexhullbuilder.cpp \
+    conflictgraph.cpp \
+    tetrahedronbuilder.cpp \
+    facebuilderhelper.cpp \
+    convexhullbuilderhelper.cpp \
+    faceplanes.cpp \
+    parallelconvexhullbuilder.cpp \
+    extremepointsfilter.cpp \
+    predicates.cpp \
+    scratcharena.cpp \
+    hullmesh.cpp \
+    hullstatistics.cpp \
+    streamingconvexhullbuilder.cpp \
+    bench/main.cpp
+
+QMAKE_CXXFLAGS += -std=c++11
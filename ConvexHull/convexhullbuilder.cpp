@@ -1,15 +1,32 @@
 #include "convexhullbuilder.h"
 #include <iostream>
 #include <stdlib.h>
+#include <cmath>
+#include <cassert>
 
 /**
  * @brief ConvexHullBuilder::ConvexHullBuilder()
- * @params DrawableDcel *dcel, MainWindow* mainWindow, bool const &showPhases
+ *        The builder works on a plain Dcel, the progress can be followed by adding observers
+ * @params Dcel *dcel, Strategy strategy order in which the vertices are inserted, randomized incremental by default
  */
-ConvexHullBuilder::ConvexHullBuilder(DrawableDcel *dcel, MainWindow* mainWindow, bool const &showPhases){
-    this->dcel       = dcel;
-    this->mainWindow = mainWindow;
-    this->showPhases = showPhases;
+ConvexHullBuilder::ConvexHullBuilder(Dcel *dcel, Strategy strategy){
+    this->dcel = dcel;
+    this->strategy = strategy;
+    this->numberOfThreads = std::thread::hardware_concurrency();
+    this->prefilter = false;
+    this->seed = std::random_device()();
+    this->randomGenerator.seed(seed);
+    this->convexHullBuilderHelper = nullptr;
+    this->tetrahedronBuilder      = nullptr;
+    this->conflictGraph           = nullptr;
+    this->faceBuilderHelper       = nullptr;
+    this->facePlanes              = nullptr;
+    this->scratchArena            = nullptr;
+    this->hullMesh                = nullptr;
+    this->statisticsOutput        = nullptr;
+    this->timerTree               = nullptr;
+    this->observedEvents          = 0;
+    this->observersDcelOutdated   = true;
 }
 
 /**
@@ -17,111 +34,493 @@ ConvexHullBuilder::ConvexHullBuilder(DrawableDcel *dcel, MainWindow* mainWindow,
  **/
 ConvexHullBuilder::~ConvexHullBuilder(){
     delete convexHullBuilderHelper;
+    delete tetrahedronBuilder;
     delete conflictGraph;
     delete faceBuilderHelper;
+    delete facePlanes;
+    delete scratchArena;
+    delete hullMesh;
+}
+
+/**
+ * @brief ConvexHullBuilder::addObserver(ConvexHullObserver* observer)
+ *        Subscribes an observer to the events emitted by computeConvexHull().
+ *        The builder does not take ownership of the observer.
+ * @param ConvexHullObserver* observer
+ */
+void ConvexHullBuilder::addObserver(ConvexHullObserver* observer){
+    observers.push_back(observer);
+    observedEvents |= observer->getEvents();
+}
+
+/**
+ * @brief ConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads)
+ *        Sets the maximum number of threads used by the parallel phases of the algorithm.
+ *        Defaults to the number of hardware threads, 1 runs everything on the calling thread.
+ * @param unsigned int const &numberOfThreads, 0 means number of hardware threads
+ */
+void ConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads){
+    this->numberOfThreads = numberOfThreads > 0 ? numberOfThreads : std::thread::hardware_concurrency();
+}
+
+/**
+ * @brief ConvexHullBuilder::setPrefilter(bool const &prefilter)
+ *        Enables the Akl-Toussaint prefilter: the vertices inside the polytope spanned by the extreme vertices
+ *        along a fixed set of directions are discarded before the tetrahedron is built. Disabled by default.
+ * @param bool const &prefilter
+ */
+void ConvexHullBuilder::setPrefilter(bool const &prefilter){
+    this->prefilter = prefilter;
+}
+
+/**
+ * @brief ConvexHullBuilder::setSeed(unsigned int const &seed)
+ *        Sets the seed of the random insertion order, the same seed on the same input builds the very same hull.
+ *        A random seed is used by default.
+ * @param unsigned int const &seed
+ */
+void ConvexHullBuilder::setSeed(unsigned int const &seed){
+    this->seed = seed;
+    this->randomGenerator.seed(seed);
+}
+
+/**
+ * @brief ConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput)
+ *        The counters of the builder (see HullStatistics) are written as JSON on the stream
+ *        at the end of each computeConvexHull() and insertPoints(). Nothing is written by default.
+ *        The builder does not take ownership of the stream.
+ * @param std::ostream* statisticsOutput, nullptr to stop writing them
+ */
+void ConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput){
+    this->statisticsOutput = statisticsOutput;
+}
+
+/**
+ * @brief ConvexHullBuilder::setTimerTree(TimerTree* timerTree)
+ *        The phases of each computeConvexHull() and insertPoints() are timed in the tree, as children of the phase
+ *        open when they are called: prefilter, tetrahedron, conflict init, insertion loop (with the horizon,
+ *        delete, build and redistribute steps of each vertex) and export. Nothing is timed by default.
+ *        The builder does not take ownership of the tree.
+ * @param TimerTree* timerTree, nullptr to stop timing
+ */
+void ConvexHullBuilder::setTimerTree(TimerTree* timerTree){
+    this->timerTree = timerTree;
 }
 
 /**
  * @brief ConvexHullBuilder::computeConvexHull() takes dcel as input.
- *        Starts the algorithm calling all the different functions needed.
- *         - Takes all the vertices from the Dcel and saves them into a vector of vertices
- *         - Resets the dcel
- *         - Calls tetrahedron's buildTetrahedron method in order to build the latter with the passed vertices
- *         - Initializes Conflict Graph with, respectively, Vertices visible from a Face and Faces visible from a Vertex
- *         - For each remaining vertex, checks if the vertex is in conflict with a certain number of faces, if so:
- *           - Gets the Horizon for the faces visible by the latter vertex
- *           - Gets Candidate Vertex Map for the passed horizon (vector of halfedges)
- *           - Deletes visible faces
- *           - For each halfedge in the Horizon
- *             - Builds a new face using the current horizon and the passed vertex
- *             - Updates the Conflict Graph with new informations
- *           - Deletes the passed Vertex
- *         If GUI checkbox is checked, it shows the different phases of the process
- *
- */
-void ConvexHullBuilder::computeConvexHull(){
+ *        Packs the coordinates of all the vertices of the dcel in one array and builds their hull in the dcel
+ *        (see buildConvexHull)
+ * @return false if the vertices are less than 4 or they are all coplanar, so they have no hull: the dcel is left empty
+ */
+bool ConvexHullBuilder::computeConvexHull(){
+    //Instantiate ScratchArena, the temporaries of each insertion are kept there
+    delete scratchArena;
+    scratchArena = new ScratchArena();
+
     //Instantiate ConvexHullBuilderHelper
-    convexHullBuilderHelper = new ConvexHullBuilderHelper(dcel);
+    delete convexHullBuilderHelper;
+    convexHullBuilderHelper = new ConvexHullBuilderHelper(dcel, scratchArena);
+
+    //Get the coordinates of all the vertices from the dcel
+    coordinates = convexHullBuilderHelper->getAllCoordinates();
 
-    //Get all the vertices from the dcel
-    std::vector<Dcel::Vertex*> dcelVertices = convexHullBuilderHelper->getAllVertices();
+    hullStatistics.reset();
+    hullStatistics.points = coordinates.size() / 3;
+    randomGenerator.seed(seed);
 
+    bool built = buildConvexHull();
+    writeStatistics();
+    return built;
+}
+
+/**
+ * @brief ConvexHullBuilder::computeConvexHull(std::vector<double> const &coordinates)
+ *        Builds the hull of the passed points in the dcel, whatever the dcel contains is discarded.
+ *        No Dcel::Vertex is needed for the input points, only the vertices of the hull are added to the dcel.
+ * @param std::vector<double> const &coordinates packed coordinates of the points, x y z for each point
+ * @return false if the points are less than 4 or they are all coplanar, so they have no hull: the dcel is left empty
+ */
+bool ConvexHullBuilder::computeConvexHull(std::vector<double> const &coordinates){
+    //Instantiate ScratchArena, the temporaries of each insertion are kept there
+    delete scratchArena;
+    scratchArena = new ScratchArena();
+
+    //Instantiate ConvexHullBuilderHelper
+    delete convexHullBuilderHelper;
+    convexHullBuilderHelper = new ConvexHullBuilderHelper(dcel, scratchArena);
+
+    //Copy of the points, the builder reorders them
+    this->coordinates = coordinates;
+
+    hullStatistics.reset();
+    hullStatistics.points = this->coordinates.size() / 3;
+    randomGenerator.seed(seed);
+
+    bool built = buildConvexHull();
+    writeStatistics();
+    return built;
+}
+
+/**
+ * @brief ConvexHullBuilder::buildConvexHull()
+ *        Starts the algorithm calling all the different functions needed.
+ *         - Resets the dcel
+ *         - If the prefilter is enabled, discards the vertices which cannot be on the hull
+ *         - Calls tetrahedron's buildTetrahedron method in order to build the latter with the packed coordinates
+ *         - Initializes Conflict Graph, each Vertex is linked to one Face in front of it
+ *         - For each remaining vertex, checks if the vertex is in conflict with a certain number of faces, if so
+ *           inserts it in the hull (see insertVertex)
+ *           - RANDOMIZED_INCREMENTAL: the vertices are taken in shuffled order
+ *           - QUICKHULL: the vertex farthest from its conflicting face is taken first, until no vertex is outside
+ *             the hull. Vertices left are inside and are never looked at again.
+ *         The vertices are only referred by their index in the packed coordinates and the faces are built
+ *         in a HullMesh: the dcel is filled only once, with the finished hull.
+ *         Each subscribed observer is notified when the tetrahedron is built, when faces are deleted
+ *         and created and when a vertex is inserted
+ * @return false if the vertices are less than 4 or they are all coplanar, so they have no hull: the dcel is left empty
+ */
+bool ConvexHullBuilder::buildConvexHull(){
     //Reset Dcel
     dcel->reset();
 
+    //Only the vertices which can be on the hull are left
+    if( prefilter ){
+        ScopedTimer prefilterTimer(timerTree, "Prefilter");
+        unsigned int verticesSize = coordinates.size() / 3;
+        discardInteriorVertices();
+        hullStatistics.pointsPrefiltered += verticesSize - coordinates.size() / 3;
+    }
+
+    //The hull of a previous build, if any, is discarded
+    delete conflictGraph;
+    delete faceBuilderHelper;
+    delete tetrahedronBuilder;
+    delete hullMesh;
+    delete facePlanes;
+    conflictGraph     = nullptr;
+    faceBuilderHelper = nullptr;
+
+    //Instantiate FacePlanes, filled with the plane of each face when the face is built
+    facePlanes = new FacePlanes(coordinates);
+
+    //Instantiate HullMesh, the faces are built there and copied to the dcel at the end
+    hullMesh = new HullMesh(coordinates);
+
     //Instantiate TetrahedronBuilder
-    tetrahedronBuilder = new TetrahedronBuilder(dcel, dcelVertices);
+    tetrahedronBuilder = new TetrahedronBuilder(hullMesh, coordinates, facePlanes, &randomGenerator);
+
+    /** Build Tetrahedron with using the first 4 vertices in coordinates (after that they have been shuffled up)
+     *  No tetrahedron, no hull: the vertices are kept, the ones inserted later may give one **/
+    ScopedTimer tetrahedronTimer(timerTree, "Tetrahedron");
+    if( !tetrahedronBuilder->buildTetrahedron() ){
+        return false;
+    }
+    tetrahedronTimer.stop();
 
-    /** Build Tetrahedron with using the first 4 vertices in dcelVertices (after that they have been shuffled up)
-     *  and return shuffled dcelVertices **/
-    dcelVertices = tetrahedronBuilder->buildTetrahedron();
+    //The 4 faces of the tetrahedron, the other vertices are left to the insertion loop
+    hullStatistics.facesCreated += hullMesh->getNumberFaces();
+    hullStatistics.pointsConsidered += coordinates.size() / 3 - 4;
 
     //Initialize FaceBuilderHelper
-    faceBuilderHelper = new FaceBuilderHelper(dcel);
+    faceBuilderHelper = new FaceBuilderHelper(hullMesh, facePlanes, &hullStatistics);
 
-    //If showPhases is checked, show the Tetrahedron
-    if(showPhases){
-        dcel->update();
-        this->mainWindow->updateGlCanvas();
+    //Notify the observers that the Tetrahedron has been built
+    observersDcelOutdated = true;
+    exportForObservers(ConvexHullObserver::TETRAHEDRON_BUILT);
+    for(auto observerIterator = observers.begin(); observerIterator != observers.end(); observerIterator++){
+        (*observerIterator)->onTetrahedronBuilt(dcel);
     }
 
     //Instantiate ConflictGraph
-    conflictGraph = new ConflictGraph(dcel, dcelVertices);
+    ScopedTimer conflictInitTimer(timerTree, "Conflict init");
+    conflictGraph = new ConflictGraph(hullMesh, coordinates, facePlanes, scratchArena, &hullStatistics, numberOfThreads);
 
-    //Initialize Conflict Graph with Dcel and dcelVertices
+    //Initialize Conflict Graph with Dcel and coordinates
     conflictGraph->initializeConflictGraph();
+    conflictInitTimer.stop();
 
-    //Get all vertices size
-    int verticesSize = dcelVertices.size();
+    ScopedTimer insertionLoopTimer(timerTree, "Insertion loop");
+    if( strategy == QUICKHULL ){
+        //Expand the hull towards the farthest vertex until all the vertices are inside
+        conflictGraph->trackFarthestVertices();
+        unsigned int vertexIndex;
+        while( conflictGraph->nextFarthestVertex(vertexIndex) ){
+            insertVertex(vertexIndex);
+        }
+    } else {
+        //Get all vertices size
+        unsigned int verticesSize = coordinates.size() / 3;
 
-    //Loop through remaining vertices
-    for(int i=4; i<verticesSize; i++){
+        //Loop through remaining vertices
+        for(unsigned int i=4; i<verticesSize; i++){
+            insertVertex(i);
+        }
+    }
+    insertionLoopTimer.stop();
 
-        //Initialize vertex to which will be assigned, each time, dcelVertices[i] vertex
-        Dcel::Vertex* currentVertex = new Dcel::Vertex;
-        currentVertex = dcelVertices[i];
+    finishConvexHull();
 
-        //Check if current vertex is in conflict with dcel's faces
-        std::tr1::unordered_set<Dcel::Face*>* facesVisibleByVertex = conflictGraph->getFacesVisibleByVertex(currentVertex);
+    return true;
 
-        //If the vertex is in front of some faces, so, facesVisibleByVertex is not empty
-        if( !facesVisibleByVertex->empty() ){
+}
 
-            //Get the Horizon for the current Visible Faces
-            std::vector<Dcel::HalfEdge*> horizon = convexHullBuilderHelper->bringMeTheHorizon(facesVisibleByVertex);
+/**
+ * @brief ConvexHullBuilder::insertPoints(std::vector<double> const &points)
+ *        Inserts new points in the hull built by the last computeConvexHull() or insertPoints(), without building
+ *        it again: the hull mesh, the face planes and the conflict graph are kept between the calls.
+ *         - The new points are appended to the hull vertices (the only ones kept) and shuffled
+ *         - Each new point is linked to the first face of the hull in conflict with it (see ConflictGraph::addVertices)
+ *         - The new points are inserted as in buildConvexHull, with the same strategy: only the faces visible
+ *           by them are deleted and only the faces on their horizon are built
+ *        Linking a point to a face may test it against all the faces of the hull, while a new build takes
+ *        expected O(n log n) tests on the hull vertices and the new points. When the new points are many
+ *        compared to the hull the latter is cheaper, so the hull is built again on them.
+ *        If there is no hull yet the new points are added to the previous ones and the hull is built on all of them.
+ *        The dcel is replaced with the updated hull.
+ * @param std::vector<double> const &points packed coordinates of the new points, x y z for each point
+ * @return false if there is still no hull, all the points seen so far being less than 4 or coplanar: the dcel is left empty
+ */
+bool ConvexHullBuilder::insertPoints(std::vector<double> const &points){
+    unsigned int firstVertex = coordinates.size() / 3;
+    coordinates.insert(coordinates.end(), points.begin(), points.begin() + points.size() / 3 * 3);
+    return insertNewVertices(firstVertex);
+}
 
-            //Get the probable visible vertices for each face of each horizon's halfedge
-            std::tr1::unordered_map<Dcel::HalfEdge*, std::tr1::unordered_set<Dcel::Vertex*>*> oldVertices = conflictGraph->joinVertices(horizon);
+/**
+ * @brief ConvexHullBuilder::insertPoints(std::vector<double> &&points)
+ *        Same as insertPoints(std::vector<double> const &points), but the builder takes the buffer of the points
+ *        instead of copying them: the kept hull vertices are moved in front of the new points and the buffer becomes
+ *        the packed coordinates of the builder. If its capacity has room for the hull vertices too, no other
+ *        buffer as large as the new points is allocated.
+ * @param std::vector<double> &&points packed coordinates of the new points, x y z for each point, left empty
+ * @return false if there is still no hull, all the points seen so far being less than 4 or coplanar: the dcel is left empty
+ */
+bool ConvexHullBuilder::insertPoints(std::vector<double> &&points){
+    unsigned int firstVertex = coordinates.size() / 3;
+    points.resize(points.size() / 3 * 3);
+    points.insert(points.begin(), coordinates.begin(), coordinates.end());
+    coordinates.swap(points);
+    std::vector<double>().swap(points);
+    return insertNewVertices(firstVertex);
+}
 
-            //Delete Visible Faces from the Conflict Graph and Dcel
-            conflictGraph->deleteFaces(facesVisibleByVertex);
+/**
+ * @brief ConvexHullBuilder::insertNewVertices(unsigned int const &firstVertex)
+ *        Inserts in the hull the vertices appended to the packed coordinates from firstVertex on (see insertPoints)
+ * @param unsigned int const &firstVertex, the vertices before it are the ones of the current hull
+ * @return false if there is still no hull
+ */
+bool ConvexHullBuilder::insertNewVertices(unsigned int const &firstVertex){
+    if( scratchArena == nullptr ){
+        scratchArena = new ScratchArena();
+        convexHullBuilderHelper = new ConvexHullBuilderHelper(dcel, scratchArena);
+    }
 
-            //Build a Face for each halfedge in the horizon and save them into an array of faces
-            std::vector<Dcel::Face*> faces = faceBuilderHelper->buildFaces(currentVertex, horizon);
+    hullStatistics.points += coordinates.size() / 3 - firstVertex;
 
-            /* Update Conflict Graph for each new face and possible vertices in conflict with them
-             * since they were in conflict with the destroyed face */
-            conflictGraph->checkConflict(faces, oldVertices, horizon);
+    bool built;
+    unsigned int verticesSize = coordinates.size() / 3;
+    const double rebuildFactor = 4;
+    if( conflictGraph == nullptr ){
+        //No hull yet
+        built = buildConvexHull();
+    } else if( (double) (verticesSize - firstVertex) * hullMesh->getNumberFaces() > rebuildFactor * verticesSize * std::log2(verticesSize) ){
+        //A new build is cheaper than testing each new point against many faces, the hull vertices are given to it again
+        hullStatistics.points += firstVertex;
+        hullStatistics.pointsReused += firstVertex;
+        built = buildConvexHull();
+    } else {
+        //The new points are tested against the current faces
+        ScopedTimer conflictInitTimer(timerTree, "Conflict init");
+        tetrahedronBuilder->verticesShuffler(firstVertex);
+        facePlanes->addCoordinates(coordinates, firstVertex);
+        conflictGraph->addVertices(coordinates, firstVertex);
+        hullStatistics.pointsConsidered += verticesSize - firstVertex;
+        conflictInitTimer.stop();
 
-            //If showPhases is clicked, show the progress
-            if( showPhases ){
-                dcel->update();
-                this->mainWindow->updateGlCanvas();
+        ScopedTimer insertionLoopTimer(timerTree, "Insertion loop");
+        if( strategy == QUICKHULL ){
+            unsigned int vertexIndex;
+            while( conflictGraph->nextFarthestVertex(vertexIndex) ){
+                insertVertex(vertexIndex);
+            }
+        } else {
+            for(unsigned int i = firstVertex; i < verticesSize; i++){
+                insertVertex(i);
             }
+        }
+        insertionLoopTimer.stop();
+
+        finishConvexHull();
+        built = true;
+    }
+
+    //Each build looks at its points once, the ones of its tetrahedron excluded
+    assert(hullStatistics.pointsPrefiltered + hullStatistics.pointsConsidered <= hullStatistics.points);
+    writeStatistics();
+    return built;
+}
 
+/**
+ * @brief ConvexHullBuilder::finishConvexHull()
+ *        Drops the vertices which are not on the hull from the packed coordinates and from the conflict graph,
+ *        so that the kept state is proportional to the hull, and copies the hull to the dcel
+ */
+void ConvexHullBuilder::finishConvexHull(){
+    ScopedTimer exportTimer(timerTree, "Export");
+    hullMesh->compactVertices(coordinates);
+    conflictGraph->addVertices(coordinates, coordinates.size() / 3);
+
+    //Copy the finished hull to the dcel
+    hullMesh->exportToDcel(dcel);
+}
+
+/**
+ * @brief ConvexHullBuilder::discardInteriorVertices()
+ *        Removes from the packed coordinates the vertices strictly inside the polytope of the extreme vertices
+ *        (see ExtremePointsFilter), keeping the order of the others
+ */
+void ConvexHullBuilder::discardInteriorVertices(){
+    ExtremePointsFilter extremePointsFilter;
+    std::vector<bool> interior = extremePointsFilter.findInteriorVertices(coordinates);
+
+    unsigned int survivors = 0;
+    for(unsigned int i = 0; i < interior.size(); i++){
+        if( !interior[i] ){
+            coordinates[survivors * 3]     = coordinates[i * 3];
+            coordinates[survivors * 3 + 1] = coordinates[i * 3 + 1];
+            coordinates[survivors * 3 + 2] = coordinates[i * 3 + 2];
+            survivors++;
         }
+    }
+    coordinates.resize(survivors * 3);
+}
+
+/**
+ * @brief ConvexHullBuilder::insertVertex(unsigned int const &vertexIndex)
+ *        Inserts a remaining vertex in the hull if it is in conflict with some faces:
+ *         - Gets the Horizon for the faces visible by the vertex
+ *         - Gets Candidate Vertices, the ones in conflict with the visible faces
+ *         - Deletes visible faces
+ *         - For each halfedge in the Horizon
+ *           - Builds a new face using the current horizon and the passed vertex
+ *           - Updates the Conflict Graph with new informations
+ *         - Erases the vertex from the Conflict Graph
+ *        All the temporaries come from the scratch arena, which is reset when the vertex has been inserted
+ * @param unsigned int const &vertexIndex index of the vertex in the packed coordinates and in the Conflict Graph
+ */
+void ConvexHullBuilder::insertVertex(unsigned int const &vertexIndex){
+
+    //Check if current vertex is in conflict with the faces of the hull
+    ScopedTimer horizonTimer(timerTree, "Horizon");
+    std::vector<unsigned int> const &facesVisibleByVertex = conflictGraph->getFacesVisibleByVertex(vertexIndex);
+
+    //If the vertex is in front of some faces, so, facesVisibleByVertex is not empty
+    if( !facesVisibleByVertex.empty() ){
 
-        //Erase The Current Vertex From the Conflict Graph
-        conflictGraph->eraseVertex(currentVertex);
+        hullStatistics.addInsertion(facesVisibleByVertex.size());
+
+        //Get the Horizon for the current Visible Faces
+        std::vector<unsigned int> const &horizon = convexHullBuilderHelper->bringMeTheHorizon(hullMesh, facesVisibleByVertex);
+        horizonTimer.stop();
+
+        //Get the probable visible vertices, the ones in conflict with the visible faces
+        ScopedTimer deleteTimer(timerTree, "Delete");
+        std::vector<unsigned int> const &oldVertices = conflictGraph->joinVertices(facesVisibleByVertex, vertexIndex);
+
+        //Delete Visible Faces from the Conflict Graph and the hull mesh, their slots are reused by the new faces
+        conflictGraph->deleteFaces(facesVisibleByVertex);
+        deleteTimer.stop();
+        observersDcelOutdated = true;
+        exportForObservers(ConvexHullObserver::FACES_DELETED);
+        for(auto observerIterator = observers.begin(); observerIterator != observers.end(); observerIterator++){
+            (*observerIterator)->onFacesDeleted(dcel, facesVisibleByVertex.size());
+        }
+
+        //Build a Face for each halfedge in the horizon and save them into an array of faces
+        std::vector<unsigned int> &faces = scratchArena->newFaces;
+        ScopedTimer buildTimer(timerTree, "Build");
+        faceBuilderHelper->buildFaces(vertexIndex, horizon, faces);
+        buildTimer.stop();
+        observersDcelOutdated = true;
+        exportForObservers(ConvexHullObserver::FACES_CREATED);
+        for(auto observerIterator = observers.begin(); observerIterator != observers.end(); observerIterator++){
+            (*observerIterator)->onFacesCreated(dcel, faces.size());
+        }
+
+        /* Update Conflict Graph for each new face and possible vertices in conflict with them
+         * since they were in conflict with the destroyed faces */
+        ScopedTimer redistributeTimer(timerTree, "Redistribute");
+        conflictGraph->checkConflict(faces, oldVertices);
+        redistributeTimer.stop();
+
+        //Notify the observers that the vertex is now part of the convex hull
+        exportForObservers(ConvexHullObserver::POINT_INSERTED);
+        for(auto observerIterator = observers.begin(); observerIterator != observers.end(); observerIterator++){
+            (*observerIterator)->onPointInserted(dcel, hullMesh->getPoint(vertexIndex));
+        }
 
     }
+    horizonTimer.stop();
+
+    //Erase The Current Vertex From the Conflict Graph
+    conflictGraph->eraseVertex(vertexIndex);
+
+    //Temporaries of this insertion are not needed anymore
+    scratchArena->reset();
+}
 
-    //Delete each vertex from the dcelVertices array
-    for (auto vertexIterator = dcelVertices.begin(); vertexIterator != dcelVertices.end(); vertexIterator++){
-        delete (*vertexIterator);
+/**
+ * @brief ConvexHullBuilder::exportForObservers(ConvexHullObserver::Event const &event)
+ *        Copies the current hull to the dcel before the observers are notified of the event, so that they can show it.
+ *        The copy is done only if some observer handles the event and the hull has changed since the last copy:
+ *        with no observers the dcel is filled only once, at the end.
+ * @param ConvexHullObserver::Event const &event about to be notified
+ */
+void ConvexHullBuilder::exportForObservers(ConvexHullObserver::Event const &event){
+    if( (observedEvents & event) != 0 && observersDcelOutdated ){
+        hullMesh->exportToDcel(dcel);
+        observersDcelOutdated = false;
     }
-    //Clear dcelVertices array
-    dcelVertices.clear();
+}
 
+/**
+ * @brief ConvexHullBuilder::getScratchPeakBytes()
+ *        Memory used by the temporaries of the largest single insertion of the last computeConvexHull()
+ * @return std::size_t bytes, 0 if no hull has been computed
+ */
+std::size_t ConvexHullBuilder::getScratchPeakBytes() const{
+    return scratchArena != nullptr ? scratchArena->getPeakBytes() : 0;
+}
+
+/**
+ * @brief ConvexHullBuilder::getScratchReservedBytes()
+ *        Memory reserved by the scratch arena at the end of the last computeConvexHull(),
+ *        it does not grow with the number of vertices inserted but only with the largest insertion
+ * @return std::size_t bytes, 0 if no hull has been computed
+ */
+std::size_t ConvexHullBuilder::getScratchReservedBytes() const{
+    return scratchArena != nullptr ? scratchArena->getReservedBytes() : 0;
+}
+
+/**
+ * @brief ConvexHullBuilder::getStatistics()
+ *        Counters of the last computeConvexHull() and of the insertPoints() called after it
+ *        When insertPoints() builds the hull again, the hull vertices given to the new build count again in the points
+ *        (see HullStatistics::pointsReused), so that each build accounts for all its points
+ * @return HullStatistics const &
+ */
+HullStatistics const & ConvexHullBuilder::getStatistics() const{
+    return hullStatistics;
 }
 
+/**
+ * @brief ConvexHullBuilder::writeStatistics()
+ *        Writes the counters as JSON on the statistics output, if any (see setStatisticsOutput)
+ */
+void ConvexHullBuilder::writeStatistics() const{
+    if( statisticsOutput != nullptr ){
+        *statisticsOutput << hullStatistics.toJson() << std::endl;
+    }
+}
@@ -2,31 +2,85 @@
 #define CONVEXHULL_H
 
 #include <vector>
-#include <GUI/managers/dcelmanager.h>
+#include <thread>
+#include <random>
+#include <ostream>
+#include <lib/dcel/dcel.h>
 #include <lib/dcel/dcel_vertex_iterators.h>
-#include <eigen3/Eigen/Dense>
-#include <eigen3/Eigen/LU>
 
 #include "convexhullbuilderhelper.h"
 #include "tetrahedronbuilder.h"
 #include "conflictgraph.h"
 #include "facebuilderhelper.h"
+#include "convexhullobserver.h"
+#include "faceplanes.h"
+#include "scratcharena.h"
+#include "hullmesh.h"
+#include "extremepointsfilter.h"
+#include "hullstatistics.h"
+#include "lib/common/timer.h"
 
 class ConvexHullBuilder{
 
 public:
-    ConvexHullBuilder(DrawableDcel* dcel, MainWindow* mainWindow, bool const &showPhases); //Constructor Declaration
+    /** Order in which the remaining vertices are inserted in the hull **/
+    enum Strategy{
+        RANDOMIZED_INCREMENTAL, //Shuffled order, each vertex is inserted if it is outside the current hull
+        QUICKHULL               //The vertex farthest from the faces of the current hull first
+    };
+
+    ConvexHullBuilder(Dcel* dcel, Strategy strategy = RANDOMIZED_INCREMENTAL); //Constructor Declaration
     ~ConvexHullBuilder(); //Destructor Declaration
-    void computeConvexHull();
+    void addObserver(ConvexHullObserver* observer);
+    void setNumberOfThreads(unsigned int const &numberOfThreads);
+    void setPrefilter(bool const &prefilter);
+    void setSeed(unsigned int const &seed);
+    void setStatisticsOutput(std::ostream* statisticsOutput);
+    void setTimerTree(TimerTree* timerTree);
+    bool computeConvexHull();
+    bool computeConvexHull(std::vector<double> const &coordinates);
+    bool insertPoints(std::vector<double> const &points);
+    bool insertPoints(std::vector<double> &&points);
+    std::size_t getScratchPeakBytes() const;
+    std::size_t getScratchReservedBytes() const;
+    HullStatistics const & getStatistics() const;
 
 private:
-    DrawableDcel            *dcel;
-    MainWindow*             mainWindow;
-    bool                    showPhases;
+    Dcel                    *dcel;
+    Strategy                strategy;
+    std::vector<ConvexHullObserver*> observers;
+    /** Events handled by at least one observer (see ConvexHullObserver::getEvents) **/
+    unsigned int            observedEvents;
+    /** True if the hull mesh has changed since it was last copied to the dcel for the observers **/
+    bool                    observersDcelOutdated;
+    unsigned int            numberOfThreads;
+    bool                    prefilter;
+    unsigned int            seed;
+    /** Generator of the insertion orders, seeded again by each computeConvexHull() and carried on by insertPoints() **/
+    std::mt19937            randomGenerator;
     ConvexHullBuilderHelper *convexHullBuilderHelper;
     TetrahedronBuilder      *tetrahedronBuilder;
     ConflictGraph           *conflictGraph;
     FaceBuilderHelper       *faceBuilderHelper;
+    FacePlanes              *facePlanes;
+    ScratchArena            *scratchArena;
+    HullMesh                *hullMesh;
+    /** Counters of the last computeConvexHull() and of the insertPoints() after it **/
+    HullStatistics          hullStatistics;
+    std::ostream            *statisticsOutput;
+    /** Phases of the build are timed there, nothing is timed if it is nullptr **/
+    TimerTree               *timerTree;
+    /** Packed coordinates of the input vertices, x y z for each vertex, while the hull is being built.
+     *  Only the vertices of the hull are kept once it is finished, the ones inserted later are appended **/
+    std::vector<double>     coordinates;
+
+    bool buildConvexHull();
+    bool insertNewVertices(unsigned int const &firstVertex);
+    void finishConvexHull();
+    void writeStatistics() const;
+    void discardInteriorVertices();
+    void insertVertex(unsigned int const &vertexIndex);
+    void exportForObservers(ConvexHullObserver::Event const &event);
 };
 
 #endif // CONVEXHULL_H
@@ -1,144 +1,82 @@
 #include "convexhullbuilderhelper.h"
 
-/** Class which contains all the methods used by ConvexHullBuilder **/
-ConvexHullBuilderHelper::ConvexHullBuilderHelper(DrawableDcel *dcel){
+/** Class which contains all the methods used by ConvexHullBuilder, the horizon is built in the passed scratch arena **/
+ConvexHullBuilderHelper::ConvexHullBuilderHelper(Dcel *dcel, ScratchArena* scratchArena){
     this->dcel = dcel;
+    this->scratchArena = scratchArena;
 }
 
 /** Class Destructor **/
 ConvexHullBuilderHelper::~ConvexHullBuilderHelper(){}
 
 /**
- * @brief  std::vector<Dcel::Vertex*> ConvexHullBuilderHelper::getAllVertices
- *         Takes all vertices from the Dcel and saves them into an arra of pointers to vertices
- * @return returns array of pointers to all vertices
+ * @brief  std::vector<double> ConvexHullBuilderHelper::getAllCoordinates
+ *         Takes the coordinates of all the vertices from the Dcel and packs them in one array, x y z for each vertex
+ * @return returns array of packed coordinates
  */
-std::vector<Dcel::Vertex*> ConvexHullBuilderHelper::getAllVertices(){
-    //Initialize vertices array
-    std::vector<Dcel::Vertex*> allVertices;
-    //Add all vertices to the latter
+std::vector<double> ConvexHullBuilderHelper::getAllCoordinates() const{
+    //Initialize coordinates array
+    std::vector<double> allCoordinates;
+    allCoordinates.reserve(dcel->getNumberVertices() * 3);
+    //Add the coordinates of all vertices to the latter
     for (auto vertex = dcel->vertexBegin(); vertex != dcel->vertexEnd(); vertex++){
-        Dcel::Vertex* currentvertex = new Dcel::Vertex((*vertex)->getCoordinate());
-        allVertices.push_back(currentvertex);
+        Pointd coordinate = (*vertex)->getCoordinate();
+        allCoordinates.push_back(coordinate.x());
+        allCoordinates.push_back(coordinate.y());
+        allCoordinates.push_back(coordinate.z());
     }
-    //Return array of pointers to vertices
-    return allVertices;
+    //Return array of coordinates
+    return allCoordinates;
 }
 
 /**
- * @brief  std::vector<Dcel::HalfEdge*> ConvexHullBuilder::bringMeTheHorizon(const std::tr1::unordered_set<Dcel::Face*>* &facesVisibleByVertex) const
- *         Takes current set of visible faces and returns a vector of ordered halfedges which form the
- *         horizon.
- *         - Loop through faces
- *           - For each HalfEdge in the face
- *             - If current given halfedge's twin is not null
- *               - Check if twin's face is visible by the current vertex
- *               - If it is not visible then the twin belongs to the horizon
- *               - Add it to the horizon and set its to and from vertex in a map
- *         - Order the horizon using the map and the horizon itself
+ * @brief  std::vector<unsigned int> const & ConvexHullBuilderHelper::bringMeTheHorizon(HullMesh* const &hullMesh, std::vector<unsigned int> const &facesVisibleByVertex)
+ *         Takes current visible faces and returns the halfedges which form the horizon, already ordered:
+ *         the from vertex of each halfedge is the to vertex of the previous one.
+ *         Visible faces are the ones with flag 1 (see ConflictGraph::getFacesVisibleByVertex).
+ *         - Finds a halfedge of a visible face whose twin is on a not visible face, it is on the boundary of the visible region
+ *         - Walks the boundary backwards: the previous boundary halfedge is found turning around the from vertex
+ *           through prev and twin links, skipping the halfedges between two visible faces
+ *         - The twin of each boundary halfedge belongs to the horizon
+ *         Each horizon halfedge is found in constant time, the horizon array comes from the scratch arena.
  *
- * @param  const std::tr1::unordered_set<Dcel::Face*>* &facesVisibleByVertex) const
- * @return returns array of pointers to halfedges belonging to the horizon
+ * @param  HullMesh* const &hullMesh, std::vector<unsigned int> const &facesVisibleByVertex
+ * @return returns array of halfedges of the mesh belonging to the horizon, valid until the scratch arena is reset
  */
-std::vector<Dcel::HalfEdge*> ConvexHullBuilderHelper::bringMeTheHorizon(std::tr1::unordered_set<Dcel::Face*>* const &facesVisibleByVertex) const{
-
-    //Initialize Horizon
-    std::vector<Dcel::HalfEdge*> horizon;
-
-    //Initialize a map which maps each important from vertex to its to vertex (only on horizon edges)
-    std::tr1::unordered_map<Dcel::Vertex*, Dcel::Vertex*> *mapOfVertices = new std::tr1::unordered_map<Dcel::Vertex*, Dcel::Vertex*>;
-
-    //For Each Face in Visible Faces
-    for(auto faceIterator = facesVisibleByVertex->begin(); faceIterator != facesVisibleByVertex->end(); faceIterator++){
-
-        //Get Current Face
-        Dcel::Face* currFace = *faceIterator;
-
-        //Initialization needed for Memory problems
-        Dcel::HalfEdge* outerHalfEdgeTwin = new Dcel::HalfEdge;
-
-        //Loop through face's halfedges
-        for( auto halfEdgeIterator = currFace->incidentHalfEdgeBegin(); halfEdgeIterator != currFace->incidentHalfEdgeEnd(); halfEdgeIterator++ ){
-\
-            //Get Current HalfEdge
-            Dcel::HalfEdge* currHalfEdge = *halfEdgeIterator;
-
-            //If its twin is not Null
-            if( currHalfEdge->getTwin() != nullptr ){
-                //Get it
-                outerHalfEdgeTwin = currHalfEdge->getTwin();
-
-                //Initialize a new face
-                Dcel::Face* twinsFace = new Dcel::Face;
-                //Get its face
-                twinsFace = outerHalfEdgeTwin->getFace();
-
-                //If the face is not visible by the Vertex
-                if( facesVisibleByVertex->count(twinsFace) == 0 ){
-                    //Get Both outerHalfEdgeFrom and outerHalfEdgeTwinFrom
-                    Dcel::Vertex* outerHalfEdgeFrom     = outerHalfEdgeTwin->getFromVertex();
-                    Dcel::Vertex* outerHalfEdgeTwinFrom = outerHalfEdgeTwin->getToVertex();
-                    //Add current halfedge from and to vertex to a map
-                    (*mapOfVertices)[outerHalfEdgeFrom] = outerHalfEdgeTwinFrom;
-                    //Add current twin to unordered horizon
-                    horizon.push_back(outerHalfEdgeTwin);
-                }
-
+std::vector<unsigned int> const & ConvexHullBuilderHelper::bringMeTheHorizon(HullMesh* const &hullMesh, std::vector<unsigned int> const &facesVisibleByVertex){
+
+    //The horizon is empty, the scratch arena has been reset after the previous insertion
+    std::vector<unsigned int> &horizon = scratchArena->horizon;
+
+    //Look for a first halfedge on the boundary of the visible region
+    unsigned int firstHalfEdge = HullMesh::noIndex;
+    for(auto faceIterator = facesVisibleByVertex.begin(); faceIterator != facesVisibleByVertex.end() && firstHalfEdge == HullMesh::noIndex; faceIterator++){
+        unsigned int outerHalfEdge = HullMesh::getOuterHalfEdge(*faceIterator);
+        for(unsigned int halfEdge = outerHalfEdge; halfEdge < outerHalfEdge + 3 && firstHalfEdge == HullMesh::noIndex; halfEdge++){
+            if( hullMesh->getFlag(HullMesh::getFace(hullMesh->getTwin(halfEdge))) != 1 ){
+                firstHalfEdge = halfEdge;
             }
-
         }
-
     }
 
-    //Get the ordered Horizon
-    horizon = orderHorizon(horizon, mapOfVertices);
-
-    //Return populated Horizon
-    return horizon;
-}
-
-/**
- * @brief std::vector<Dcel::HalfEdge*> ConvexHullBuilder::orderHorizon
- *        Reorders the Horizon for future utilizations (setting twins) using from and to vertex from the map
- * @param std::vector<Dcel::HalfEdge*> const &unHorizon, std::tr1::unordered_map<Dcel::Vertex*, Dcel::Vertex*>* const &map
- * @return ordered Horizon
- */
-std::vector<Dcel::HalfEdge*> ConvexHullBuilderHelper::orderHorizon(std::vector<Dcel::HalfEdge*> const &unHorizon, std::tr1::unordered_map<Dcel::Vertex*, Dcel::Vertex*>* const &map) const{
-    //Initialize Ordered Horizon
-    std::vector<Dcel::HalfEdge*> orderedHorizon;
-
-    //Initialize from and to Vertex
-    Dcel::Vertex* fromVertex = new Dcel::Vertex;
-    Dcel::Vertex* toVertex   = new Dcel::Vertex;
-
-    //While all the halfedges haven't been ordered
-    while(unHorizon.size() != orderedHorizon.size()){
-        //The very first time
-        if( orderedHorizon.empty() ){
-            //Take from vertex of first's halfedge in the horizon
-            fromVertex = unHorizon.front()->getFromVertex();
-        } else {
-            //The next fromVertex is the old toVertex
-            fromVertex = toVertex;
-        }
+    //No boundary, no horizon
+    if( firstHalfEdge == HullMesh::noIndex ){
+        return horizon;
+    }
 
-        //if fromVertex exists
-        if( fromVertex != nullptr){
-            //Get to vertex using the map. For [fromVertex] will contain only the next toVertex
-            toVertex = (*map)[fromVertex];
+    //Walk the boundary backwards, so that consecutive twins are chained from -> to
+    unsigned int boundaryHalfEdge = firstHalfEdge;
+    do {
+        horizon.push_back(hullMesh->getTwin(boundaryHalfEdge));
 
-            //For All the Halfedges
-            for(auto unHorizonIterator = unHorizon.begin(); unHorizonIterator != unHorizon.end(); unHorizonIterator ++ ){
-                //If that halfedge has exact same from and to vertex of the ordered ones
-                if( (*unHorizonIterator)->getFromVertex() == fromVertex && (*unHorizonIterator)->getToVertex() == toVertex ){
-                    //Add it to the ordered horizon
-                    orderedHorizon.push_back(*unHorizonIterator);
-                }
-            }
+        //Turn around the from vertex until the twin is on a not visible face
+        unsigned int previousHalfEdge = HullMesh::getPrev(boundaryHalfEdge);
+        while( hullMesh->getFlag(HullMesh::getFace(hullMesh->getTwin(previousHalfEdge))) == 1 ){
+            previousHalfEdge = HullMesh::getPrev(hullMesh->getTwin(previousHalfEdge));
         }
+        boundaryHalfEdge = previousHalfEdge;
+    } while( boundaryHalfEdge != firstHalfEdge );
 
-    }
-
-    //Return ordered horizon
-    return orderedHorizon;
+    //Return populated Horizon
+    return horizon;
 }
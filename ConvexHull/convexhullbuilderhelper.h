@@ -1,22 +1,24 @@
 #ifndef CONVEXHULLBUILDERHELPER_H
 #define CONVEXHULLBUILDERHELPER_H
 
-#include <tr1/unordered_map>
-#include <tr1/unordered_set>
-#include "lib/dcel/drawable_dcel.h"
+#include <vector>
+#include "lib/dcel/dcel.h"
+#include "scratcharena.h"
+#include "hullmesh.h"
 
 class ConvexHullBuilderHelper
 {
 public:
-    ConvexHullBuilderHelper(DrawableDcel* dcel);
+    ConvexHullBuilderHelper(Dcel* dcel, ScratchArena* scratchArena);
     ~ConvexHullBuilderHelper(); //Class Destructor
 
-    std::vector<Dcel::Vertex*>   getAllVertices();
-    std::vector<Dcel::HalfEdge*> bringMeTheHorizon(std::tr1::unordered_set<Dcel::Face*>* const &facesVisibleByVertex) const;
-    std::vector<Dcel::HalfEdge*> orderHorizon(std::vector<Dcel::HalfEdge*> const &unHorizon, std::tr1::unordered_map<Dcel::Vertex*, Dcel::Vertex*>* const &map) const;
+    std::vector<double>          getAllCoordinates() const;
+    std::vector<unsigned int>    const & bringMeTheHorizon(HullMesh* const &hullMesh, std::vector<unsigned int> const &facesVisibleByVertex);
 
 private:
-    DrawableDcel *dcel;
+    Dcel *dcel;
+    /** Temporaries of the current insertion, the horizon is kept there **/
+    ScratchArena *scratchArena;
 };
 
 #endif // CONVEXHULLBUILDERHELPER_H
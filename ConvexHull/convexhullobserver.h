@@ -0,0 +1,45 @@
+#ifndef CONVEXHULLOBSERVER_H
+#define CONVEXHULLOBSERVER_H
+
+#include <vector>
+#include "lib/dcel/dcel.h"
+
+/**
+ * @brief ConvexHullObserver
+ *        Interface used by ConvexHullBuilder to notify the progress of the algorithm.
+ *        Every method has an empty default implementation, so a subscriber only overrides
+ *        the events it is interested in. The builder never calls an observer that has not been
+ *        added with ConvexHullBuilder::addObserver, so nothing is paid in the main loop when
+ *        there are no subscribers.
+ *        The builder works on its own HullMesh, the dcel passed to the observers is filled with a copy
+ *        of the current hull before a notification, only if some subscriber handles that event (see getEvents)
+ *        and the hull has changed since the last copy.
+ */
+class ConvexHullObserver{
+
+public:
+    /** Events of the builder, as bits of the mask returned by getEvents **/
+    enum Event{
+        TETRAHEDRON_BUILT = 1,
+        FACES_DELETED     = 2,
+        FACES_CREATED     = 4,
+        POINT_INSERTED    = 8,
+        ALL_EVENTS        = 15
+    };
+
+    virtual ~ConvexHullObserver(){}
+
+    //Events handled by the observer, the builder copies the hull to the dcel only before these ones
+    virtual unsigned int getEvents() const { return ALL_EVENTS; }
+
+    //The starting tetrahedron has been inserted in the dcel
+    virtual void onTetrahedronBuilt(Dcel* /*dcel*/){}
+    //Faces visible by the current vertex have been removed from the dcel
+    virtual void onFacesDeleted(Dcel* /*dcel*/, unsigned int const &/*deletedFaces*/){}
+    //New faces have been built between the current vertex and the horizon
+    virtual void onFacesCreated(Dcel* /*dcel*/, unsigned int const &/*createdFaces*/){}
+    //The current vertex has been inserted in the convex hull
+    virtual void onPointInserted(Dcel* /*dcel*/, Pointd const &/*point*/){}
+};
+
+#endif // CONVEXHULLOBSERVER_H
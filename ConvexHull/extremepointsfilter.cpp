@@ -0,0 +1,163 @@
+#include "extremepointsfilter.h"
+#include <algorithm>
+#include <limits>
+
+#include "convexhullbuilder.h"
+
+/**
+ * @brief ExtremePointsFilter::ExtremePointsFilter()
+ */
+ExtremePointsFilter::ExtremePointsFilter(){}
+
+/**
+ * @brief ExtremePointsFilter Class Destructor
+ **/
+ExtremePointsFilter::~ExtremePointsFilter(){
+    normalsX.clear();
+    normalsY.clear();
+    normalsZ.clear();
+    offsets.clear();
+}
+
+/**
+ * @brief ExtremePointsFilter::findInteriorVertices(std::vector<double> const &coordinates)
+ *        - Finds the extreme vertices along the fixed directions
+ *        - Builds the polytope they span
+ *        - Marks each vertex strictly inside all the planes of the polytope
+ *        The coordinates are split in three arrays and tested a block at a time, plane by plane,
+ *        with no branches in the inner loop, so that the compiler can vectorize it.
+ *        If the extreme vertices are coplanar no vertex is marked.
+ * @param  std::vector<double> const &coordinates packed coordinates of the vertices, x y z for each vertex
+ * @return std::vector<bool> true at the position of each vertex which cannot be on the hull
+ */
+std::vector<bool> ExtremePointsFilter::findInteriorVertices(std::vector<double> const &coordinates){
+    unsigned int verticesNumber = coordinates.size() / 3;
+    std::vector<bool> interior(verticesNumber, false);
+
+    std::vector<Pointd> extremePoints = getExtremePoints(coordinates);
+    if( !buildPolytope(extremePoints) ){
+        return interior;
+    }
+
+    //Points closer than tolerance to a plane of the polytope are kept, the hull decides about them
+    Pointd min = extremePoints[0], max = extremePoints[0];
+    for(auto pointIterator = extremePoints.begin(); pointIterator != extremePoints.end(); pointIterator++){
+        min = min.min(*pointIterator);
+        max = max.max(*pointIterator);
+    }
+    const double tolerance = (max - min).getLength() * 1e-9;
+
+    //Coordinates of a block and, for each vertex, its greatest distance from the planes of the polytope
+    const unsigned int blockSize = 1024;
+    double x[blockSize], y[blockSize], z[blockSize], maxDistance[blockSize];
+    unsigned int planesNumber = offsets.size();
+
+    for(unsigned int blockBegin = 0; blockBegin < verticesNumber; blockBegin += blockSize){
+        unsigned int blockLength = std::min(blockSize, verticesNumber - blockBegin);
+
+        for(unsigned int i = 0; i < blockLength; i++){
+            x[i] = coordinates[(blockBegin + i) * 3];
+            y[i] = coordinates[(blockBegin + i) * 3 + 1];
+            z[i] = coordinates[(blockBegin + i) * 3 + 2];
+            maxDistance[i] = -std::numeric_limits<double>::max();
+        }
+
+        for(unsigned int p = 0; p < planesNumber; p++){
+            const double nx = normalsX[p], ny = normalsY[p], nz = normalsZ[p], d = offsets[p];
+            for(unsigned int i = 0; i < blockLength; i++){
+                maxDistance[i] = std::max(maxDistance[i], nx * x[i] + ny * y[i] + nz * z[i] - d);
+            }
+        }
+
+        for(unsigned int i = 0; i < blockLength; i++){
+            interior[blockBegin + i] = maxDistance[i] < -tolerance;
+        }
+    }
+
+    return interior;
+}
+
+/**
+ * @brief ExtremePointsFilter::getExtremePoints(std::vector<double> const &coordinates) const
+ *        Finds, for each of the 14 fixed directions, the vertex with the greatest projection on it
+ * @param  std::vector<double> const &coordinates packed coordinates of the vertices
+ * @return std::vector<Pointd> extreme points, with no duplicates
+ */
+std::vector<Pointd> ExtremePointsFilter::getExtremePoints(std::vector<double> const &coordinates) const{
+    static const double directions[14][3] = {
+        { 1, 0, 0}, {-1, 0, 0}, { 0, 1, 0}, { 0,-1, 0}, { 0, 0, 1}, { 0, 0,-1},
+        { 1, 1, 1}, { 1, 1,-1}, { 1,-1, 1}, { 1,-1,-1}, {-1, 1, 1}, {-1, 1,-1}, {-1,-1, 1}, {-1,-1,-1}
+    };
+
+    std::vector<Pointd> extremePoints;
+    unsigned int verticesNumber = coordinates.size() / 3;
+    if( verticesNumber == 0 ){
+        return extremePoints;
+    }
+
+    std::vector<unsigned int> extremeIndices(14, 0);
+    std::vector<double> extremeValues(14, -std::numeric_limits<double>::max());
+
+    //One pass over the vertices for all the directions
+    for(unsigned int i = 0; i < verticesNumber; i++){
+        double const *coordinate = &coordinates[i * 3];
+        for(unsigned int d = 0; d < 14; d++){
+            double value = directions[d][0] * coordinate[0] + directions[d][1] * coordinate[1] + directions[d][2] * coordinate[2];
+            if( value > extremeValues[d] ){
+                extremeValues[d] = value;
+                extremeIndices[d] = i;
+            }
+        }
+    }
+
+    //The same vertex can be extreme along more directions
+    std::sort(extremeIndices.begin(), extremeIndices.end());
+    extremeIndices.erase(std::unique(extremeIndices.begin(), extremeIndices.end()), extremeIndices.end());
+    for(auto indexIterator = extremeIndices.begin(); indexIterator != extremeIndices.end(); indexIterator++){
+        unsigned int i = *indexIterator;
+        extremePoints.push_back(Pointd(coordinates[i * 3], coordinates[i * 3 + 1], coordinates[i * 3 + 2]));
+    }
+    return extremePoints;
+}
+
+/**
+ * @brief ExtremePointsFilter::buildPolytope(std::vector<Pointd> const &extremePoints)
+ *        Builds the convex hull of the extreme points in a dcel of its own and saves the plane of each face
+ * @param  std::vector<Pointd> const &extremePoints
+ * @return false if the extreme points are coplanar, so they span no polytope
+ */
+bool ExtremePointsFilter::buildPolytope(std::vector<Pointd> const &extremePoints){
+    std::vector<double> extremeCoordinates;
+    for(auto pointIterator = extremePoints.begin(); pointIterator != extremePoints.end(); pointIterator++){
+        extremeCoordinates.push_back(pointIterator->x());
+        extremeCoordinates.push_back(pointIterator->y());
+        extremeCoordinates.push_back(pointIterator->z());
+    }
+    Dcel polytope;
+    ConvexHullBuilder convexHullBuilder(&polytope);
+    convexHullBuilder.setNumberOfThreads(1);
+    convexHullBuilder.setSeed(0);
+    if( !convexHullBuilder.computeConvexHull(extremeCoordinates) ){
+        return false;
+    }
+
+    //Plane of each face, the half edges of a face are counter-clockwise seen from outside
+    for(auto faceIterator = polytope.faceBegin(); faceIterator != polytope.faceEnd(); ++faceIterator){
+        Dcel::HalfEdge* outerHalfEdge = (*faceIterator)->getOuterHalfEdge();
+        Pointd v0 = outerHalfEdge->getFromVertex()->getCoordinate();
+        Pointd v1 = outerHalfEdge->getNext()->getFromVertex()->getCoordinate();
+        Pointd v2 = outerHalfEdge->getNext()->getNext()->getFromVertex()->getCoordinate();
+
+        Vec3 normal = (v1 - v0).cross(v2 - v0);
+        double length = normal.getLength();
+        if( length == 0 ){
+            continue;
+        }
+        normal /= length;
+        normalsX.push_back(normal.x());
+        normalsY.push_back(normal.y());
+        normalsZ.push_back(normal.z());
+        offsets.push_back(normal.dot(v0));
+    }
+    return !offsets.empty();
+}
@@ -0,0 +1,32 @@
+#ifndef EXTREMEPOINTSFILTER_H
+#define EXTREMEPOINTSFILTER_H
+
+#include <vector>
+#include "lib/dcel/dcel.h"
+
+/**
+ * @brief ExtremePointsFilter
+ *        Akl-Toussaint heuristic: the points extreme along a fixed set of directions (+-x, +-y, +-z and the
+ *        8 diagonals) span a polytope inside the convex hull, so every point strictly inside the polytope
+ *        cannot be a vertex of the hull and can be discarded before the hull is built.
+ */
+class ExtremePointsFilter{
+
+public:
+    ExtremePointsFilter();
+    ~ExtremePointsFilter(); //Destructor Declaration
+
+    std::vector<bool> findInteriorVertices(std::vector<double> const &coordinates);
+
+private:
+    /** Planes of the faces of the polytope, normals are unit length and point outwards **/
+    std::vector<double> normalsX;
+    std::vector<double> normalsY;
+    std::vector<double> normalsZ;
+    std::vector<double> offsets;
+
+    std::vector<Pointd> getExtremePoints(std::vector<double> const &coordinates) const;
+    bool buildPolytope(std::vector<Pointd> const &extremePoints);
+};
+
+#endif // EXTREMEPOINTSFILTER_H
@@ -1,17 +1,22 @@
 #ifndef FACEBUILDERHELPER_H
 #define FACEBUILDERHELPER_H
 
-#include "lib/dcel/drawable_dcel.h"
+#include "hullmesh.h"
+#include "faceplanes.h"
+#include "hullstatistics.h"
 
 class FaceBuilderHelper{
 
 public:
-    FaceBuilderHelper(DrawableDcel* dcel);
+    FaceBuilderHelper(HullMesh* hullMesh, FacePlanes* facePlanes, HullStatistics* hullStatistics = nullptr);
     ~FaceBuilderHelper(); //Destructor Declaration
-    std::vector<Dcel::Face*> buildFaces(Dcel::Vertex* const &passedVertex, std::vector<Dcel::HalfEdge*> const &halfEdges) const;
+    void buildFaces(unsigned int const &vertex, std::vector<unsigned int> const &halfEdges, std::vector<unsigned int> &faces) const;
 
 private:
-    DrawableDcel *dcel;
+    HullMesh *hullMesh;
+    FacePlanes *facePlanes;
+    /** Counters of the builder, nullptr if the faces are not counted **/
+    HullStatistics *hullStatistics;
 };
 
 #endif // FACEBUILDERHELPER_H
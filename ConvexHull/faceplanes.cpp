@@ -0,0 +1,91 @@
+#include "faceplanes.h"
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief FacePlanes::FacePlanes()
+ * @param std::vector<double> const &coordinates packed xyz of all the points the faces will be tested against, used for the error bounds
+ */
+FacePlanes::FacePlanes(std::vector<double> const &coordinates){
+    maxCoordinate = 0;
+    for(auto coordinateIterator = coordinates.begin(); coordinateIterator != coordinates.end(); coordinateIterator++){
+        maxCoordinate = std::max(maxCoordinate, std::abs(*coordinateIterator));
+    }
+}
+
+/**
+ * @brief FacePlanes Class Destructor
+ **/
+FacePlanes::~FacePlanes(){
+    planes.clear();
+    vertices.clear();
+}
+
+/**
+ * @brief FacePlanes::setPlane(unsigned int const &faceId, Pointd const &v0, Pointd const &v1, Pointd const &v2)
+ *        Saves the vertices of a new face, given in counter-clockwise order, and computes its normal (v1 - v0) x (v2 - v0).
+ *        The rounding errors of the normal and of normal.dot(point - v0) are bounded by a small multiple of epsilon
+ *        times the sum of the absolute values of the products in the cross product, times the greatest
+ *        absolute value of point - v0, which is at most twice the greatest input coordinate.
+ * @param unsigned int const &faceId, Pointd const &v0, Pointd const &v1, Pointd const &v2
+ */
+void FacePlanes::setPlane(unsigned int const &faceId, Pointd const &v0, Pointd const &v1, Pointd const &v2){
+
+    //Grow the storage the first time a face id is seen
+    if( faceId >= vertices.size() / 3 ){
+        planes.resize((faceId + 1) * 7);
+        vertices.resize((faceId + 1) * 3);
+    }
+
+    vertices[faceId * 3]     = v0;
+    vertices[faceId * 3 + 1] = v1;
+    vertices[faceId * 3 + 2] = v2;
+
+    Vec3 normal = (v1 - v0).cross(v2 - v0);
+
+    double *plane = &planes[faceId * 7];
+    plane[0] = v0.x();
+    plane[1] = v0.y();
+    plane[2] = v0.z();
+    plane[3] = normal.x();
+    plane[4] = normal.y();
+    plane[5] = normal.z();
+
+    setErrorBound(faceId);
+}
+
+/**
+ * @brief FacePlanes::addCoordinates(std::vector<double> const &coordinates, unsigned int const &firstVertex)
+ *        The points from firstVertex on are new and will be tested against the faces too.
+ *        If one of them has a coordinate greater than all the previous ones the error bounds of all the
+ *        faces are recomputed, otherwise they still hold and nothing is done.
+ * @param std::vector<double> const &coordinates packed xyz of the points, unsigned int const &firstVertex first new point
+ */
+void FacePlanes::addCoordinates(std::vector<double> const &coordinates, unsigned int const &firstVertex){
+    double previousMaxCoordinate = maxCoordinate;
+    for(auto coordinateIterator = coordinates.begin() + firstVertex * 3; coordinateIterator != coordinates.end(); coordinateIterator++){
+        maxCoordinate = std::max(maxCoordinate, std::abs(*coordinateIterator));
+    }
+
+    if( maxCoordinate > previousMaxCoordinate ){
+        unsigned int facesNumber = vertices.size() / 3;
+        for(unsigned int faceId = 0; faceId < facesNumber; faceId++){
+            setErrorBound(faceId);
+        }
+    }
+}
+
+/**
+ * @brief FacePlanes::setErrorBound(unsigned int const &faceId)
+ *        Computes the error bound of the face from its saved vertices and the greatest input coordinate
+ * @param unsigned int const &faceId
+ */
+void FacePlanes::setErrorBound(unsigned int const &faceId){
+    Vec3 e1 = vertices[faceId * 3 + 1] - vertices[faceId * 3];
+    Vec3 e2 = vertices[faceId * 3 + 2] - vertices[faceId * 3];
+
+    double permanent = std::abs(e1.y() * e2.z()) + std::abs(e1.z() * e2.y())
+                     + std::abs(e1.z() * e2.x()) + std::abs(e1.x() * e2.z())
+                     + std::abs(e1.x() * e2.y()) + std::abs(e1.y() * e2.x());
+    planes[faceId * 7 + 6] = 16 * std::numeric_limits<double>::epsilon() * permanent * 2 * maxCoordinate;
+}
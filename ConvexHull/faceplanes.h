@@ -0,0 +1,72 @@
+#ifndef FACEPLANES_H
+#define FACEPLANES_H
+
+#include <vector>
+#include "predicates.h"
+
+/**
+ * @brief FacePlanes
+ *        Caches the three vertices, the normal and an error bound of each face of the hull, indexed by face id.
+ *        They are saved once, when the face is created by TetrahedronBuilder or FaceBuilderHelper,
+ *        so that the visibility test done by ConflictGraph does not walk the mesh and does no allocations.
+ *        The first vertex, the normal and the error bound of a face are packed next to each other, the points
+ *        are tested straight from the packed xyz array of the builder.
+ *        The visibility test is exact: the sign of normal.dot(point - v0) is trusted only if its absolute value is
+ *        greater than the worst rounding error for any point of the input, otherwise orient3d decides.
+ *        Face ids are recycled by the HullMesh, so is the storage.
+ */
+class FacePlanes{
+
+public:
+    FacePlanes(std::vector<double> const &coordinates);
+    ~FacePlanes(); //Destructor Declaration
+
+    void setPlane(unsigned int const &faceId, Pointd const &v0, Pointd const &v1, Pointd const &v2);
+    void addCoordinates(std::vector<double> const &coordinates, unsigned int const &firstVertex);
+    bool isVisible(unsigned int const &faceId, double const *point) const;
+    double distance(unsigned int const &faceId, double const *point) const;
+
+private:
+    /** Greatest absolute value of a coordinate of the input points **/
+    double maxCoordinate;
+    /** Seven doubles per face: first vertex, normal and error bound **/
+    std::vector<double> planes;
+    /** Three per face, only read by the exact test **/
+    std::vector<Pointd> vertices;
+
+    void setErrorBound(unsigned int const &faceId);
+};
+
+/**
+ * @brief FacePlanes::isVisible(unsigned int const &faceId, double const *point) const
+ *        Checks if the point lies strictly in front of the face, so they are in conflict.
+ *        Points coplanar with the face are not in conflict with it.
+ * @param  unsigned int const &faceId, double const *point x, y and z of the point
+ * @return true if the point is in front of the face
+ */
+inline bool FacePlanes::isVisible(unsigned int const &faceId, double const *point) const{
+    double const *plane = &planes[faceId * 7];
+    double value = plane[3] * (point[0] - plane[0]) + plane[4] * (point[1] - plane[1]) + plane[5] * (point[2] - plane[2]);
+
+    if( value > plane[6] ){
+        return true;
+    }
+    if( value < -plane[6] ){
+        return false;
+    }
+    return orient3d(vertices[faceId * 3], vertices[faceId * 3 + 1], vertices[faceId * 3 + 2], Pointd(point[0], point[1], point[2])) > 0;
+}
+
+/**
+ * @brief FacePlanes::distance(unsigned int const &faceId, double const *point) const
+ *        Signed distance of the point from the face plane, positive if the point is in front of the face
+ * @param  unsigned int const &faceId, double const *point x, y and z of the point
+ * @return double distance
+ */
+inline double FacePlanes::distance(unsigned int const &faceId, double const *point) const{
+    double const *plane = &planes[faceId * 7];
+    double value = plane[3] * (point[0] - plane[0]) + plane[4] * (point[1] - plane[1]) + plane[5] * (point[2] - plane[2]);
+    return value / std::sqrt(plane[3] * plane[3] + plane[4] * plane[4] + plane[5] * plane[5]);
+}
+
+#endif // FACEPLANES_H
@@ -0,0 +1,186 @@
+#include "hullmesh.h"
+
+const unsigned int HullMesh::noIndex;
+const unsigned char HullMesh::deletedFlag;
+
+/**
+ * @brief HullMesh::HullMesh()
+ * @param std::vector<double> const &coordinates packed xyz of the points, the vertices of the mesh are indices in it.
+ *        They must outlive the mesh.
+ */
+HullMesh::HullMesh(std::vector<double> const &coordinates){
+    this->coordinates = &coordinates;
+}
+
+/**
+ * @brief HullMesh Class Destructor
+ **/
+HullMesh::~HullMesh(){
+    vertices.clear();
+    twins.clear();
+    flags.clear();
+    freeFaces.clear();
+}
+
+/**
+ * @brief HullMesh::addFace(unsigned int const &v0, unsigned int const &v1, unsigned int const &v2)
+ *        Adds a triangle with vertices v0, v1, v2 in counter-clockwise order: its half-edges go from v0 to v1,
+ *        from v1 to v2 and from v2 to v0. Twins are not set. The slot of a deleted face is reused if there is one.
+ * @param unsigned int const &v0, unsigned int const &v1, unsigned int const &v2 indices of the points
+ * @return unsigned int the new face
+ */
+unsigned int HullMesh::addFace(unsigned int const &v0, unsigned int const &v1, unsigned int const &v2){
+    unsigned int face;
+    if( !freeFaces.empty() ){
+        face = freeFaces.back();
+        freeFaces.pop_back();
+    } else {
+        face = flags.size();
+        vertices.resize(vertices.size() + 3);
+        twins.resize(twins.size() + 3);
+        flags.push_back(0);
+    }
+
+    unsigned int halfEdge = getOuterHalfEdge(face);
+    vertices[halfEdge]     = v0;
+    vertices[halfEdge + 1] = v1;
+    vertices[halfEdge + 2] = v2;
+    twins[halfEdge]     = noIndex;
+    twins[halfEdge + 1] = noIndex;
+    twins[halfEdge + 2] = noIndex;
+    flags[face] = 0;
+
+    return face;
+}
+
+/**
+ * @brief HullMesh::deleteFace(unsigned int const &face)
+ *        Puts the face in the free list. Its half-edges are not unlinked from their twins:
+ *        the faces on the other side are either deleted too or get new twins right after.
+ * @param unsigned int const &face
+ */
+void HullMesh::deleteFace(unsigned int const &face){
+    flags[face] = deletedFlag;
+    freeFaces.push_back(face);
+}
+
+/**
+ * @brief HullMesh::setTwins(unsigned int const &halfEdge, unsigned int const &twin)
+ *        Links two half-edges on the opposite sides of the same edge
+ * @param unsigned int const &halfEdge, unsigned int const &twin
+ */
+void HullMesh::setTwins(unsigned int const &halfEdge, unsigned int const &twin){
+    twins[halfEdge] = twin;
+    twins[twin] = halfEdge;
+}
+
+/**
+ * @brief HullMesh::getFaceCapacity() const
+ * @return unsigned int number of face slots, every face is lower than it, deleted ones included
+ */
+unsigned int HullMesh::getFaceCapacity() const{
+    return flags.size();
+}
+
+/**
+ * @brief HullMesh::getNumberFaces() const
+ * @return unsigned int number of faces which are not deleted
+ */
+unsigned int HullMesh::getNumberFaces() const{
+    return flags.size() - freeFaces.size();
+}
+
+/**
+ * @brief HullMesh::getPoint(unsigned int const &vertex) const
+ * @param unsigned int const &vertex index of the point
+ * @return Pointd coordinates of the point
+ */
+Pointd HullMesh::getPoint(unsigned int const &vertex) const{
+    return Pointd((*coordinates)[vertex * 3], (*coordinates)[vertex * 3 + 1], (*coordinates)[vertex * 3 + 2]);
+}
+
+/**
+ * @brief HullMesh::exportToDcel(Dcel* dcel)
+ *        Replaces the content of the dcel with the faces of the mesh which are not deleted:
+ *        the points used by the faces are packed with the faces as triangles of their indices,
+ *        and the dcel is built in one pass from them (see Dcel::buildFromIndexedTriangles),
+ *        with the same counter-clockwise orientation.
+ *        Takes time proportional to the size of the mesh, not of the input.
+ * @param Dcel* dcel
+ */
+void HullMesh::exportToDcel(Dcel* dcel){
+    //Dcel vertex id of each point, grown once to the number of points and left empty after each export
+    if( exportedVertices.size() < coordinates->size() / 3 ){
+        exportedVertices.assign(coordinates->size() / 3, noIndex);
+    }
+
+    std::vector<double> exportedCoordinates;
+    std::vector<unsigned int> triangles;
+    exportedCoordinates.reserve(getNumberFaces() * 3 / 2 + 6);
+    triangles.reserve(getNumberFaces() * 3);
+
+    unsigned int facesNumber = flags.size();
+    unsigned int verticesNumber = 0;
+    for(unsigned int face = 0; face < facesNumber; face++){
+        if( isDeleted(face) ){
+            continue;
+        }
+        for(unsigned int halfEdge = getOuterHalfEdge(face); halfEdge < getOuterHalfEdge(face) + 3; halfEdge++){
+            unsigned int vertex = vertices[halfEdge];
+            if( exportedVertices[vertex] == noIndex ){
+                exportedVertices[vertex] = verticesNumber++;
+                exportedCoordinates.insert(exportedCoordinates.end(), coordinates->begin() + vertex * 3, coordinates->begin() + vertex * 3 + 3);
+            }
+            triangles.push_back(exportedVertices[vertex]);
+        }
+    }
+
+    //Empty the map for the next export
+    for(unsigned int face = 0; face < facesNumber; face++){
+        if( !isDeleted(face) ){
+            unsigned int outerHalfEdge = getOuterHalfEdge(face);
+            exportedVertices[vertices[outerHalfEdge]]     = noIndex;
+            exportedVertices[vertices[outerHalfEdge + 1]] = noIndex;
+            exportedVertices[vertices[outerHalfEdge + 2]] = noIndex;
+        }
+    }
+
+    dcel->buildFromIndexedTriangles(exportedCoordinates, triangles);
+}
+
+/**
+ * @brief HullMesh::compactVertices(std::vector<double> &coordinates)
+ *        Keeps in the packed coordinates only the points used by the faces which are not deleted, in the order
+ *        they are first found, and renumbers the vertices of the faces accordingly. All the other points are dropped,
+ *        so the coordinates take memory proportional to the hull instead of the input.
+ * @param std::vector<double> &coordinates the packed xyz the mesh was built on
+ */
+void HullMesh::compactVertices(std::vector<double> &coordinates){
+    //New index of each point, noIndex for the points not on the hull
+    std::vector<unsigned int> newVertices(coordinates.size() / 3, noIndex);
+
+    std::vector<double> hullCoordinates;
+    hullCoordinates.reserve(getNumberFaces() * 3 / 2 + 6);
+
+    unsigned int facesNumber = flags.size();
+    unsigned int verticesNumber = 0;
+    for(unsigned int face = 0; face < facesNumber; face++){
+        if( isDeleted(face) ){
+            continue;
+        }
+        for(unsigned int halfEdge = getOuterHalfEdge(face); halfEdge < getOuterHalfEdge(face) + 3; halfEdge++){
+            unsigned int vertex = vertices[halfEdge];
+            if( newVertices[vertex] == noIndex ){
+                newVertices[vertex] = verticesNumber++;
+                hullCoordinates.insert(hullCoordinates.end(), coordinates.begin() + vertex * 3, coordinates.begin() + vertex * 3 + 3);
+            }
+            vertices[halfEdge] = newVertices[vertex];
+        }
+    }
+
+    //Exact size, the memory of the dropped points is released
+    std::vector<double>(hullCoordinates.begin(), hullCoordinates.end()).swap(coordinates);
+
+    //The export map was sized on the old points
+    std::vector<unsigned int>().swap(exportedVertices);
+}
@@ -0,0 +1,163 @@
+#ifndef HULLMESH_H
+#define HULLMESH_H
+
+#include <vector>
+#include <limits>
+#include "lib/dcel/dcel.h"
+
+/**
+ * @brief HullMesh
+ *        Compact half-edge mesh used by ConvexHullBuilder while the hull is being built.
+ *        Every face is a triangle and owns the three consecutive half-edges 3*face, 3*face+1 and 3*face+2,
+ *        so next, prev and face of a half-edge are computed from its index and only the from vertex and the
+ *        twin of each half-edge are stored. Vertices are the indices of the points in the packed coordinates.
+ *        Deleted faces go to a free list and their slots are reused by the next faces, so adding and deleting
+ *        faces never allocates once the arrays have grown. The hull is copied to a Dcel only at the end
+ *        (see exportToDcel).
+ */
+class HullMesh{
+
+public:
+    /** Index stored where there is no face, half-edge or vertex **/
+    static const unsigned int noIndex = std::numeric_limits<unsigned int>::max();
+
+    HullMesh(std::vector<double> const &coordinates);
+    ~HullMesh(); //Destructor Declaration
+
+    unsigned int addFace(unsigned int const &v0, unsigned int const &v1, unsigned int const &v2);
+    void deleteFace(unsigned int const &face);
+    void setTwins(unsigned int const &halfEdge, unsigned int const &twin);
+    void exportToDcel(Dcel* dcel);
+    void compactVertices(std::vector<double> &coordinates);
+
+    unsigned int getTwin(unsigned int const &halfEdge) const;
+    unsigned int getFromVertex(unsigned int const &halfEdge) const;
+    unsigned int getToVertex(unsigned int const &halfEdge) const;
+    static unsigned int getNext(unsigned int const &halfEdge);
+    static unsigned int getPrev(unsigned int const &halfEdge);
+    static unsigned int getFace(unsigned int const &halfEdge);
+    static unsigned int getOuterHalfEdge(unsigned int const &face);
+
+    unsigned char getFlag(unsigned int const &face) const;
+    void setFlag(unsigned int const &face, unsigned char const &flag);
+    void resetFlag(unsigned int const &face);
+    bool isDeleted(unsigned int const &face) const;
+    unsigned int getFaceCapacity() const;
+    unsigned int getNumberFaces() const;
+    Pointd getPoint(unsigned int const &vertex) const;
+
+private:
+    /** Packed xyz of the points, owned by ConvexHullBuilder **/
+    const std::vector<double> *coordinates;
+    /** From vertex of each half-edge, three per face **/
+    std::vector<unsigned int> vertices;
+    /** Twin of each half-edge, three per face **/
+    std::vector<unsigned int> twins;
+    /** Flag of each face, used by the visibility search, deletedFlag for the faces in the free list **/
+    std::vector<unsigned char> flags;
+    /** Stack of the deleted faces, reused by addFace **/
+    std::vector<unsigned int> freeFaces;
+    /** Dcel vertex id of each point, only filled during exportToDcel **/
+    std::vector<unsigned int> exportedVertices;
+
+    static const unsigned char deletedFlag = 255;
+};
+
+/**
+ * @brief HullMesh::getTwin(unsigned int const &halfEdge) const
+ * @param unsigned int const &halfEdge
+ * @return unsigned int twin half-edge, in the face on the other side of the edge
+ */
+inline unsigned int HullMesh::getTwin(unsigned int const &halfEdge) const{
+    return twins[halfEdge];
+}
+
+/**
+ * @brief HullMesh::getFromVertex(unsigned int const &halfEdge) const
+ * @param unsigned int const &halfEdge
+ * @return unsigned int index of the point the half-edge starts from
+ */
+inline unsigned int HullMesh::getFromVertex(unsigned int const &halfEdge) const{
+    return vertices[halfEdge];
+}
+
+/**
+ * @brief HullMesh::getToVertex(unsigned int const &halfEdge) const
+ * @param unsigned int const &halfEdge
+ * @return unsigned int index of the point the half-edge ends in
+ */
+inline unsigned int HullMesh::getToVertex(unsigned int const &halfEdge) const{
+    return vertices[getNext(halfEdge)];
+}
+
+/**
+ * @brief HullMesh::getNext(unsigned int const &halfEdge)
+ * @param unsigned int const &halfEdge
+ * @return unsigned int next half-edge in the same face, counter-clockwise
+ */
+inline unsigned int HullMesh::getNext(unsigned int const &halfEdge){
+    return halfEdge % 3 == 2 ? halfEdge - 2 : halfEdge + 1;
+}
+
+/**
+ * @brief HullMesh::getPrev(unsigned int const &halfEdge)
+ * @param unsigned int const &halfEdge
+ * @return unsigned int previous half-edge in the same face
+ */
+inline unsigned int HullMesh::getPrev(unsigned int const &halfEdge){
+    return halfEdge % 3 == 0 ? halfEdge + 2 : halfEdge - 1;
+}
+
+/**
+ * @brief HullMesh::getFace(unsigned int const &halfEdge)
+ * @param unsigned int const &halfEdge
+ * @return unsigned int face the half-edge belongs to
+ */
+inline unsigned int HullMesh::getFace(unsigned int const &halfEdge){
+    return halfEdge / 3;
+}
+
+/**
+ * @brief HullMesh::getOuterHalfEdge(unsigned int const &face)
+ * @param unsigned int const &face
+ * @return unsigned int first half-edge of the face, the other two follow it
+ */
+inline unsigned int HullMesh::getOuterHalfEdge(unsigned int const &face){
+    return face * 3;
+}
+
+/**
+ * @brief HullMesh::getFlag(unsigned int const &face) const
+ * @param unsigned int const &face
+ * @return unsigned char flag of the face, 0 unless set by the visibility search
+ */
+inline unsigned char HullMesh::getFlag(unsigned int const &face) const{
+    return flags[face];
+}
+
+/**
+ * @brief HullMesh::setFlag(unsigned int const &face, unsigned char const &flag)
+ * @param unsigned int const &face, unsigned char const &flag
+ */
+inline void HullMesh::setFlag(unsigned int const &face, unsigned char const &flag){
+    flags[face] = flag;
+}
+
+/**
+ * @brief HullMesh::resetFlag(unsigned int const &face)
+ * @param unsigned int const &face
+ */
+inline void HullMesh::resetFlag(unsigned int const &face){
+    flags[face] = 0;
+}
+
+/**
+ * @brief HullMesh::isDeleted(unsigned int const &face) const
+ * @param unsigned int const &face
+ * @return true if the face slot is in the free list
+ */
+inline bool HullMesh::isDeleted(unsigned int const &face) const{
+    return flags[face] == deletedFlag;
+}
+
+#endif // HULLMESH_H
@@ -0,0 +1,100 @@
+#include "hullstatistics.h"
+#include <sstream>
+#include <algorithm>
+
+/**
+ * @brief HullStatistics::HullStatistics() Class Constructor, all the counters start from 0
+ */
+HullStatistics::HullStatistics(){
+    reset();
+}
+
+/**
+ * @brief HullStatistics Class Destructor
+ **/
+HullStatistics::~HullStatistics(){}
+
+/**
+ * @brief HullStatistics::reset()
+ *        Sets all the counters to 0
+ */
+void HullStatistics::reset(){
+    points = pointsReused = pointsPrefiltered = pointsConsidered = pointsInserted = 0;
+    visibleFaces = maxVisibleFaces = 0;
+    horizonLength = maxHorizonLength = horizons = 0;
+    conflictInserts = conflictErases = 0;
+    facesCreated = facesDeleted = 0;
+    halfSpaceChecks = 0;
+}
+
+/**
+ * @brief HullStatistics::addInsertion(unsigned long long const &visibleFaces)
+ *        Counts a point inserted in the hull and the faces visible by it
+ * @param unsigned long long const &visibleFaces
+ */
+void HullStatistics::addInsertion(unsigned long long const &visibleFaces){
+    pointsInserted++;
+    this->visibleFaces += visibleFaces;
+    maxVisibleFaces = std::max(maxVisibleFaces, visibleFaces);
+}
+
+/**
+ * @brief HullStatistics::addHorizon(unsigned long long const &horizonLength)
+ *        Counts a horizon and its halfedges
+ * @param unsigned long long const &horizonLength
+ */
+void HullStatistics::addHorizon(unsigned long long const &horizonLength){
+    horizons++;
+    this->horizonLength += horizonLength;
+    maxHorizonLength = std::max(maxHorizonLength, horizonLength);
+}
+
+/**
+ * @brief HullStatistics::add(HullStatistics const &other)
+ *        Adds the counters of another build, the maxima are the greatest of the two
+ * @param HullStatistics const &other
+ */
+void HullStatistics::add(HullStatistics const &other){
+    points            += other.points;
+    pointsReused      += other.pointsReused;
+    pointsPrefiltered += other.pointsPrefiltered;
+    pointsConsidered  += other.pointsConsidered;
+    pointsInserted    += other.pointsInserted;
+    visibleFaces      += other.visibleFaces;
+    maxVisibleFaces    = std::max(maxVisibleFaces, other.maxVisibleFaces);
+    horizonLength     += other.horizonLength;
+    maxHorizonLength   = std::max(maxHorizonLength, other.maxHorizonLength);
+    horizons          += other.horizons;
+    conflictInserts   += other.conflictInserts;
+    conflictErases    += other.conflictErases;
+    facesCreated      += other.facesCreated;
+    facesDeleted      += other.facesDeleted;
+    halfSpaceChecks   += other.halfSpaceChecks;
+}
+
+/**
+ * @brief HullStatistics::toJson() const
+ *        Writes the counters as a JSON object, with the mean number of visible faces per insertion
+ *        and the mean horizon length
+ * @return std::string JSON object
+ */
+std::string HullStatistics::toJson() const{
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"points\": " << points << ",\n"
+         << "  \"pointsReused\": " << pointsReused << ",\n"
+         << "  \"pointsPrefiltered\": " << pointsPrefiltered << ",\n"
+         << "  \"pointsInserted\": " << pointsInserted << ",\n"
+         << "  \"pointsSkipped\": " << pointsConsidered - pointsInserted << ",\n"
+         << "  \"visibleFacesPerInsertion\": { \"total\": " << visibleFaces << ", \"max\": " << maxVisibleFaces
+         << ", \"mean\": " << (pointsInserted > 0 ? (double) visibleFaces / pointsInserted : 0) << " },\n"
+         << "  \"horizonLength\": { \"total\": " << horizonLength << ", \"max\": " << maxHorizonLength
+         << ", \"mean\": " << (horizons > 0 ? (double) horizonLength / horizons : 0) << " },\n"
+         << "  \"conflictInserts\": " << conflictInserts << ",\n"
+         << "  \"conflictErases\": " << conflictErases << ",\n"
+         << "  \"facesCreated\": " << facesCreated << ",\n"
+         << "  \"facesDeleted\": " << facesDeleted << ",\n"
+         << "  \"halfSpaceChecks\": " << halfSpaceChecks << "\n"
+         << "}";
+    return json.str();
+}
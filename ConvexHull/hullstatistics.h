@@ -0,0 +1,42 @@
+#ifndef HULLSTATISTICS_H
+#define HULLSTATISTICS_H
+
+#include <string>
+
+/**
+ * @brief HullStatistics
+ *        Counters of the work done by ConvexHullBuilder, filled while the hull is built.
+ *        The builder owns them and passes them to ConflictGraph and FaceBuilderHelper, like the scratch arena,
+ *        each one counts its own events. They tell apart slow inputs with large horizons, with many conflict
+ *        updates or with many visibility tests.
+ */
+class HullStatistics{
+
+public:
+    HullStatistics();
+    ~HullStatistics(); //Destructor Declaration
+
+    void reset();
+    void addInsertion(unsigned long long const &visibleFaces);
+    void addHorizon(unsigned long long const &horizonLength);
+    void add(HullStatistics const &other);
+    std::string toJson() const;
+
+    unsigned long long points;              //Points given to the builds, the reused ones included
+    unsigned long long pointsReused;        //Hull vertices given again to a new build of the same hull
+    unsigned long long pointsPrefiltered;   //Points discarded by the prefilter
+    unsigned long long pointsConsidered;    //Points looked at by the insertion loop, the ones of the tetrahedron excluded
+    unsigned long long pointsInserted;      //Points found outside the current hull and inserted
+    unsigned long long visibleFaces;        //Faces visible by the inserted points, in total
+    unsigned long long maxVisibleFaces;     //Faces visible by a single inserted point, at most
+    unsigned long long horizonLength;       //Halfedges of the horizons, in total
+    unsigned long long maxHorizonLength;    //Halfedges of a single horizon, at most
+    unsigned long long horizons;            //Horizons built, one per inserted point
+    unsigned long long conflictInserts;     //Points linked to a face in the conflict graph
+    unsigned long long conflictErases;      //Points unlinked because their face has been deleted
+    unsigned long long facesCreated;        //Faces built, the ones of the tetrahedron included
+    unsigned long long facesDeleted;        //Faces deleted because visible by an inserted point
+    unsigned long long halfSpaceChecks;     //Point against face visibility tests
+};
+
+#endif // HULLSTATISTICS_H
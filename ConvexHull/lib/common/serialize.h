@@ -246,7 +246,7 @@ template <typename T, typename ...A>
 inline void Serializer::serialize(const std::vector<T, A...> &v, std::ofstream& binaryFile){
     size_t size = v.size();
     Serializer::serialize(size, binaryFile);
-    for (typename std::vector<T, A...>::iterator it = v.begin(); it != v.end(); ++it)
+    for (typename std::vector<T, A...>::const_iterator it = v.begin(); it != v.end(); ++it)
         Serializer::serialize((*it), binaryFile);
 }
 
@@ -1,35 +1,180 @@
 #pragma once
 
-#include <QString>
-
-#include <time.h>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sstream>
 #include <iostream>
 
+/**
+ * @brief Timer
+ *        Wall-clock timer of a single phase. It is measured with steady_clock, so it keeps counting while the
+ *        process waits for I/O and it does not add up the time of the threads as clock() does.
+ */
 class Timer {
     public:
-        Timer (QString _caption) : caption(_caption) {
-            secs = 0.f;
+        Timer (std::string _caption) : caption(_caption) {
+            secs = 0;
             start();
         }
 
         inline void start(){
-            //DGP::logger << "[start]\t" << caption.toStdString() << DGP::endl;
-            _start = clock();
+            _start = std::chrono::steady_clock::now();
         }
 
         inline void stop_and_print() {
-            _stop = clock();
-            float cycles = _stop - _start;
-            secs = ((float)cycles) / ((float)CLOCKS_PER_SEC);
-            std::cout << "[" << secs << " secs]\t" << caption.toStdString() << std::endl;
+            secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+            std::cout << "[" << secs << " secs]\t" << caption << std::endl;
+        }
+
+        inline double delay() {
+            return secs;
+        }
+
+    private:
+        std::string caption;
+        std::chrono::steady_clock::time_point _start;
+        double secs;
+};
+
+/**
+ * @brief TimerTree
+ *        Wall-clock times of nested phases, measured with steady_clock.
+ *        A phase begun while another one is open is one of its children. A phase begun again under the same
+ *        parent, like the steps of each insertion, is the same phase: its time and its number of calls add up.
+ *        Phases are usually opened and closed by ScopedTimer.
+ */
+class TimerTree {
+    public:
+        TimerTree() {
+            clear();
+        }
+
+        /**
+         * @brief Opens a child of the innermost open phase, the caption must outlive the tree
+         */
+        inline void begin(const char* caption) {
+            Phase &parent = phases[openPhases.back()];
+            unsigned int phase = 0;
+            for (unsigned int i = 0; i < parent.children.size() && phase == 0; i++) {
+                if (std::strcmp(phases[parent.children[i]].caption, caption) == 0)
+                    phase = parent.children[i];
+            }
+            if (phase == 0) {
+                phase = phases.size();
+                phases[openPhases.back()].children.push_back(phase);
+                phases.push_back(Phase(caption));
+            }
+            openPhases.push_back(phase);
+            phases[phase].start = std::chrono::steady_clock::now();
+        }
+
+        /**
+         * @brief Closes the innermost open phase
+         */
+        inline void end() {
+            Phase &phase = phases[openPhases.back()];
+            phase.secs += std::chrono::duration<double>(std::chrono::steady_clock::now() - phase.start).count();
+            phase.calls++;
+            openPhases.pop_back();
         }
 
-        inline float delay() {
+        /**
+         * @brief Seconds spent in the outermost phase with the caption, 0 if there is none
+         */
+        inline double getSecs(const char* caption) const {
+            for (unsigned int i = 0; i < phases[0].children.size(); i++) {
+                if (std::strcmp(phases[phases[0].children[i]].caption, caption) == 0)
+                    return phases[phases[0].children[i]].secs;
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Seconds spent in all the outermost phases
+         */
+        inline double getTotalSecs() const {
+            double secs = 0;
+            for (unsigned int i = 0; i < phases[0].children.size(); i++)
+                secs += phases[phases[0].children[i]].secs;
             return secs;
         }
 
+        /**
+         * @brief One line per phase with the same layout of Timer, children are indented under their parent
+         * and the phases run more than once show their number of calls
+         */
+        inline std::string toString() const {
+            std::ostringstream stream;
+            for (unsigned int i = 0; i < phases[0].children.size(); i++)
+                print(stream, phases[0].children[i], 0);
+            return stream.str();
+        }
+
+        inline void clear() {
+            phases.assign(1, Phase(""));
+            openPhases.assign(1, 0);
+        }
+
+    private:
+        struct Phase {
+            Phase(const char* _caption) : caption(_caption), secs(0), calls(0) {}
+            const char* caption;
+            double secs;
+            unsigned long long calls;
+            std::vector<unsigned int> children;
+            std::chrono::steady_clock::time_point start;
+        };
+        /** Phase 0 is the root, it is always open and it is not printed **/
+        std::vector<Phase> phases;
+        std::vector<unsigned int> openPhases;
+
+        inline void print(std::ostringstream &stream, unsigned int phase, unsigned int depth) const {
+            stream << "[" << phases[phase].secs << " secs]\t" << std::string(depth * 2, ' ') << phases[phase].caption;
+            if (phases[phase].calls > 1)
+                stream << " (" << phases[phase].calls << " calls)";
+            stream << "\n";
+            for (unsigned int i = 0; i < phases[phase].children.size(); i++)
+                print(stream, phases[phase].children[i], depth + 1);
+        }
+};
+
+/**
+ * @brief ScopedTimer
+ *        Opens a phase of the tree when it is built and closes it when it goes out of scope, or earlier with stop().
+ *        A stopped phase can be opened again with start(), its times add up.
+ *        With a null tree nothing is measured, so timing can be left in the code at the cost of one check.
+ */
+class ScopedTimer {
+    public:
+        ScopedTimer(TimerTree* _timerTree, const char* _caption) : timerTree(_timerTree), caption(_caption), running(false) {
+            start();
+        }
+
+        ~ScopedTimer() {
+            stop();
+        }
+
+        inline void start() {
+            if (timerTree != nullptr && !running) {
+                timerTree->begin(caption);
+                running = true;
+            }
+        }
+
+        inline void stop() {
+            if (running) {
+                timerTree->end();
+                running = false;
+            }
+        }
+
     private:
-        QString caption;
-        clock_t _start, _stop;
-        float secs;
+        ScopedTimer(const ScopedTimer&);
+        ScopedTimer& operator= (const ScopedTimer&);
+
+        TimerTree* timerTree;
+        const char* caption;
+        bool running;
 };
@@ -0,0 +1,154 @@
+#ifndef DCEL_POOL_H
+#define DCEL_POOL_H
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstddef>
+
+/**
+ * \~Italian
+ * @class DcelPool
+ * @brief Allocatore a blocchi (slab) per gli elementi della Dcel.
+ *
+ * Gli elementi vengono costruiti all'interno di blocchi contigui di memoria posseduti dal pool, e non vengono mai
+ * spostati: i puntatori restituiti da DcelPool::create restano validi fino alla DcelPool::destroy dell'elemento
+ * o alla DcelPool::clear.
+ * Lo slot di un elemento distrutto finisce in una lista libera (pila), e viene riutilizzato dal successivo elemento creato.
+ * La DcelPool::clear e il distruttore liberano i blocchi interi, senza chiamare il distruttore degli elementi ancora vivi:
+ * è compito della Dcel distruggerli prima (vedere Dcel::reset).
+ */
+template <class T>
+class DcelPool {
+
+    public:
+
+        DcelPool();
+        ~DcelPool();
+
+        template <typename ...Args> T* create(Args&&... args);
+        void destroy(T* element);
+        void reserve(unsigned int n);
+        void clear();
+
+    private:
+
+        DcelPool(const DcelPool&);
+        DcelPool& operator= (const DcelPool&);
+
+        T* allocate();
+
+        static const unsigned int minSlabSize = 1024; /**< \~Italian @brief Numero minimo di elementi di un blocco. */
+
+        std::vector<T*>             slabs;      /**< \~Italian @brief Blocchi allocati. */
+        std::vector<unsigned int>   slabSizes;  /**< \~Italian @brief Numero di elementi di ogni blocco. */
+        std::vector<T*>             freeSlots;  /**< \~Italian @brief Pila degli slot degli elementi distrutti. */
+        unsigned int                used;       /**< \~Italian @brief Numero di slot già usati dell'ultimo blocco. */
+};
+
+/**
+ * \~Italian
+ * @brief Costruttore vuoto, non alloca nessun blocco.
+ */
+template <class T>
+inline DcelPool<T>::DcelPool() : used(0) {
+}
+
+/**
+ * \~Italian
+ * @brief Distruttore, libera tutti i blocchi.
+ */
+template <class T>
+inline DcelPool<T>::~DcelPool() {
+    clear();
+}
+
+/**
+ * \~Italian
+ * @brief Costruisce un elemento in uno slot libero, passando gli argomenti al suo costruttore.
+ * @return Il puntatore all'elemento, stabile fino alla sua distruzione
+ * @par Complessità:
+ *      \e O(1) ammortizzato
+ */
+template <class T>
+template <typename ...Args>
+inline T* DcelPool<T>::create(Args&&... args) {
+    return new (allocate()) T(std::forward<Args>(args)...);
+}
+
+/**
+ * \~Italian
+ * @brief Distrugge un elemento creato dal pool e ne rende lo slot riutilizzabile.
+ * @param[in] element: elemento da distruggere
+ * @par Complessità:
+ *      \e O(1)
+ */
+template <class T>
+inline void DcelPool<T>::destroy(T* element) {
+    element->~T();
+    freeSlots.push_back(element);
+}
+
+/**
+ * \~Italian
+ * @brief Fa in modo che i prossimi n elementi creati non richiedano altre allocazioni,
+ * allocando se necessario un unico blocco della dimensione mancante.
+ * @param[in] n: numero di elementi
+ */
+template <class T>
+inline void DcelPool<T>::reserve(unsigned int n) {
+    unsigned int available = freeSlots.size() + (slabs.empty() ? 0 : slabSizes.back() - used);
+    if (n > available) {
+        slabs.push_back(static_cast<T*>(::operator new(sizeof(T) * (n - available))));
+        slabSizes.push_back(n - available);
+        //gli slot rimasti nel blocco precedente restano disponibili nella lista libera
+        if (slabs.size() > 1) {
+            T* previous = slabs[slabs.size() - 2];
+            for (unsigned int i = used; i < slabSizes[slabSizes.size() - 2]; i++)
+                freeSlots.push_back(previous + i);
+        }
+        used = 0;
+    }
+}
+
+/**
+ * \~Italian
+ * @brief Libera tutti i blocchi in un colpo solo.
+ * @warning Gli elementi ancora vivi non vengono distrutti, devono essere distrutti prima mediante DcelPool::destroy
+ * o chiamando direttamente il loro distruttore.
+ */
+template <class T>
+inline void DcelPool<T>::clear() {
+    for (unsigned int i = 0; i < slabs.size(); i++)
+        ::operator delete(slabs[i]);
+    slabs.clear();
+    slabSizes.clear();
+    freeSlots.clear();
+    used = 0;
+}
+
+/**
+ * \~Italian
+ * @brief Restituisce uno slot non inizializzato: l'ultimo liberato se c'è, altrimenti il prossimo dell'ultimo blocco.
+ * Quando l'ultimo blocco è pieno ne viene allocato uno nuovo, grande quanto tutti i precedenti messi insieme.
+ * @return Lo slot
+ */
+template <class T>
+inline T* DcelPool<T>::allocate() {
+    if (!freeSlots.empty()) {
+        T* slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    if (slabs.empty() || used == slabSizes.back()) {
+        unsigned int size = minSlabSize;
+        for (unsigned int i = 0; i < slabSizes.size(); i++)
+            size += slabSizes[i];
+        slabs.push_back(static_cast<T*>(::operator new(sizeof(T) * size)));
+        slabSizes.push_back(size);
+        used = 0;
+    }
+    return slabs.back() + used++;
+}
+
+#endif // DCEL_POOL_H
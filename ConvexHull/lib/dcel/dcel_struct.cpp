@@ -40,17 +40,18 @@ Dcel::Dcel(const Dcel& dcel) {
  * @brief Distruttore della Dcel.
  *
  * Elimina tutti gli elementi contenuti nelle liste dei vertici, degli half edge e delle facce della Dcel.
+ * I blocchi di memoria che li contenevano vengono liberati dai pool.
  */
 Dcel::~Dcel() {
     for (unsigned int i=0; i<vertices.size(); i++)
         if (vertices[i]!= nullptr)
-            delete vertices[i];
+            vertices[i]->~Vertex();
     for (unsigned int i=0; i<halfEdges.size(); i++)
         if (halfEdges[i] != nullptr)
-            delete halfEdges[i];
+            halfEdges[i]->~HalfEdge();
     for (unsigned int i=0; i<faces.size(); i++)
         if (faces[i] != nullptr)
-            delete faces[i];
+            faces[i]->~Face();
 }
 
 /******************
@@ -316,7 +317,7 @@ void Dcel::serialize(std::ofstream &binaryFile) const {
     Serializer::serialize(nVertices, binaryFile);
     Serializer::serialize(nHalfEdges, binaryFile);
     Serializer::serialize(nFaces, binaryFile);
-    //Sets
+    //Unused ids, in the order of their stacks
     Serializer::serialize(unusedVids, binaryFile);
     Serializer::serialize(unusedHeids, binaryFile);
     Serializer::serialize(unusedFids, binaryFile);
@@ -424,16 +425,16 @@ Dcel::Face* Dcel::getFace(unsigned int idFace) {
  *      \e O(1)
  */
 Dcel::Vertex* Dcel::addVertex() {
-    Vertex* last= new Vertex();
-    if (unusedVids.size() == 0) {
+    Vertex* last= vertexPool.create();
+    if (unusedVids.empty()) {
         last->setId(nVertices);
         vertices.push_back(last);
     }
     else {
-        int vid = *(unusedVids.begin());
+        int vid = unusedVids.back();
         last->setId(vid);
         vertices[vid] = last;
-        unusedVids.erase(vid);
+        unusedVids.pop_back();
     }
     nVertices++;
     return last;
@@ -452,16 +453,16 @@ Dcel::Vertex* Dcel::addVertex() {
  *      \e O(1)
  */
 Dcel::Vertex* Dcel::addVertex(const Dcel::Vertex& v) {
-    Dcel::Vertex* last= new Dcel::Vertex(v);
-    if (unusedVids.size() == 0) {
+    Dcel::Vertex* last= vertexPool.create(v);
+    if (unusedVids.empty()) {
         last->setId(nVertices);
         vertices.push_back(last);
     }
     else {
-        int vid = *(unusedVids.begin());
+        int vid = unusedVids.back();
         last->setId(vid);
         vertices[vid] = last;
-        unusedVids.erase(vid);
+        unusedVids.pop_back();
     }
     nVertices++;
     return last;
@@ -480,16 +481,16 @@ Dcel::Vertex* Dcel::addVertex(const Dcel::Vertex& v) {
  *      \e O(1)
  */
 Dcel::Vertex *Dcel::addVertex(const Pointd& p) {
-    Vertex* last= new Vertex(p);
-    if (unusedVids.size() == 0) {
+    Vertex* last= vertexPool.create(p);
+    if (unusedVids.empty()) {
         last->setId(nVertices);
         vertices.push_back(last);
     }
     else {
-        int vid = *(unusedVids.begin());
+        int vid = unusedVids.back();
         last->setId(vid);
         vertices[vid] = last;
-        unusedVids.erase(vid);
+        unusedVids.pop_back();
     }
     nVertices++;
     return last;
@@ -507,16 +508,16 @@ Dcel::Vertex *Dcel::addVertex(const Pointd& p) {
  *      \e O(1)
  */
 Dcel::HalfEdge* Dcel::addHalfEdge() {
-    HalfEdge* last = new HalfEdge();
-    if (unusedHeids.size() == 0){
+    HalfEdge* last = halfEdgePool.create();
+    if (unusedHeids.empty()){
         last->setId(nHalfEdges);
         halfEdges.push_back(last);
     }
     else {
-        int heid = *(unusedHeids.begin());
+        int heid = unusedHeids.back();
         last->setId(heid);
         halfEdges[heid] = last;
-        unusedHeids.erase(heid);
+        unusedHeids.pop_back();
     }
     nHalfEdges++;
     return last;
@@ -535,16 +536,16 @@ Dcel::HalfEdge* Dcel::addHalfEdge() {
  *      \e O(1)
  */
 Dcel::HalfEdge* Dcel::addHalfEdge(const Dcel::HalfEdge& he)	{
-    HalfEdge* last = new HalfEdge(he);
-    if (unusedHeids.size() == 0){
+    HalfEdge* last = halfEdgePool.create(he);
+    if (unusedHeids.empty()){
         last->setId(nHalfEdges);
         halfEdges.push_back(last);
     }
     else {
-        int heid = *(unusedHeids.begin());
+        int heid = unusedHeids.back();
         last->setId(heid);
         halfEdges[heid] = last;
-        unusedHeids.erase(heid);
+        unusedHeids.pop_back();
     }
     nHalfEdges++;
     return last;
@@ -562,16 +563,16 @@ Dcel::HalfEdge* Dcel::addHalfEdge(const Dcel::HalfEdge& he)	{
  *      \e O(1)
  */
 Dcel::Face* Dcel::addFace() {
-    Face* last = new Face();
-    if (unusedFids.size() == 0){
+    Face* last = facePool.create();
+    if (unusedFids.empty()){
         last->setId(nFaces);
         faces.push_back(last);
     }
     else {
-        int fid = *(unusedFids.begin());
+        int fid = unusedFids.back();
         last->setId(fid);
         faces[fid] = last;
-        unusedFids.erase(fid);
+        unusedFids.pop_back();
     }
     nFaces++;
     return last;
@@ -590,21 +591,173 @@ Dcel::Face* Dcel::addFace() {
  *      \e O(1)
  */
 Dcel::Face* Dcel::addFace(const Dcel::Face& f) {
-    Face* last = new Face(f);
-    if (unusedFids.size() == 0){
+    Face* last = facePool.create(f);
+    if (unusedFids.empty()){
         last->setId(nFaces);
         faces.push_back(last);
     }
     else {
-        int fid = *(unusedFids.begin());
+        int fid = unusedFids.back();
         last->setId(fid);
         faces[fid] = last;
-        unusedFids.erase(fid);
+        unusedFids.pop_back();
     }
     nFaces++;
     return last;
 }
 
+/**
+ * \~Italian
+ * @brief Costruisce l'intera Dcel a partire da un array di coordinate e da un array di poligoni indicizzati.
+ *
+ * Prima della costruzione viene chiamata la Dcel::reset(). Lo spazio per tutti gli elementi viene riservato
+ * una sola volta (un unico blocco per tipo nei pool), e ogni elemento viene creato senza passare per gli id non utilizzati:
+ * - il vertice i ha coordinate (coordinates[3i], coordinates[3i+1], coordinates[3i+2]) e id i;
+ * - la faccia j ha id j, e i suoi half edge hanno id consecutivi nell'ordine dei suoi vertici.
+ *
+ * I twin vengono trovati ordinando gli half edge per la coppia (estremo di indice minore, estremo di indice maggiore)
+ * con due counting sort, in modo che gli half edge dello stesso lato siano consecutivi e vengano accoppiati in una
+ * sola passata, qualunque sia la valenza dei vertici. Gli half edge di bordo restano senza twin.
+ * La cardinalità di ogni vertice è pari al numero di half edge uscenti, come nei loader.
+ * Normali, aree e colori delle facce non vengono calcolati.
+ *
+ * @param[in] coordinates: coordinate x y z di ogni vertice
+ * @param[in] polygonVertices: indici dei vertici di tutti i poligoni, uno dopo l'altro, in senso antiorario
+ * @param[in] polygonSizes: numero di vertici di ogni poligono
+ * @par Complessità:
+ *      \e O(numVertices \e + \e NumHalfEdges \e + \e NumFaces)
+ */
+void Dcel::buildFromIndexedPolygons(const std::vector<double>& coordinates, const std::vector<unsigned int>& polygonVertices, const std::vector<unsigned int>& polygonSizes) {
+    reset();
+    unsigned int numberVertices = coordinates.size() / 3;
+    unsigned int numberHalfEdges = polygonVertices.size();
+    unsigned int numberFaces = polygonSizes.size();
+    vertices.reserve(numberVertices);
+    halfEdges.reserve(numberHalfEdges);
+    faces.reserve(numberFaces);
+    vertexPool.reserve(numberVertices);
+    halfEdgePool.reserve(numberHalfEdges);
+    facePool.reserve(numberFaces);
+
+    for (unsigned int i = 0; i < numberVertices; i++) {
+        Pointd coord(coordinates[i*3], coordinates[i*3+1], coordinates[i*3+2]);
+        if (i == 0) {
+            boundingBox.setMin(coord);
+            boundingBox.setMax(coord);
+        }
+        if (coord.x() < boundingBox.getMinX()) boundingBox.setMinX(coord.x());
+        if (coord.y() < boundingBox.getMinY()) boundingBox.setMinY(coord.y());
+        if (coord.z() < boundingBox.getMinZ()) boundingBox.setMinZ(coord.z());
+
+        if (coord.x() > boundingBox.getMaxX()) boundingBox.setMaxX(coord.x());
+        if (coord.y() > boundingBox.getMaxY()) boundingBox.setMaxY(coord.y());
+        if (coord.z() > boundingBox.getMaxZ()) boundingBox.setMaxZ(coord.z());
+
+        Vertex* v = vertexPool.create(coord);
+        v->setId(i);
+        vertices.push_back(v);
+    }
+
+    // indice del to vertex di ogni half edge, usato per trovare i twin
+    std::vector<unsigned int> toVertices(numberHalfEdges);
+    unsigned int firstHalfEdge = 0;
+    for (unsigned int j = 0; j < numberFaces; j++) {
+        Face* f = facePool.create();
+        f->setId(j);
+        faces.push_back(f);
+
+        unsigned int size = polygonSizes[j];
+        for (unsigned int k = 0; k < size; k++) {
+            HalfEdge* he = halfEdgePool.create();
+            he->setId(firstHalfEdge + k);
+            halfEdges.push_back(he);
+        }
+        for (unsigned int k = 0; k < size; k++) {
+            unsigned int next = (k + 1) % size;
+            HalfEdge* he = halfEdges[firstHalfEdge + k];
+            Vertex* from = vertices[polygonVertices[firstHalfEdge + k]];
+            toVertices[firstHalfEdge + k] = polygonVertices[firstHalfEdge + next];
+            he->setFromVertex(from);
+            he->setToVertex(vertices[toVertices[firstHalfEdge + k]]);
+            he->setNext(halfEdges[firstHalfEdge + next]);
+            he->setPrev(halfEdges[firstHalfEdge + (k + size - 1) % size]);
+            he->setFace(f);
+            from->setIncidentHalfEdge(he);
+            from->incrementCardinality();
+        }
+        f->setOuterHalfEdge(halfEdges[firstHalfEdge]);
+        firstHalfEdge += size;
+    }
+    nVertices = numberVertices;
+    nHalfEdges = numberHalfEdges;
+    nFaces = numberFaces;
+
+    // gli half edge vengono ordinati per estremo di indice maggiore e poi, in modo stabile, per estremo di indice minore:
+    // gli half edge con gli stessi estremi diventano consecutivi
+    std::vector<unsigned int> byMax(numberHalfEdges), sorted(numberHalfEdges);
+    std::vector<unsigned int> bucketStart(numberVertices + 1, 0);
+    for (unsigned int i = 0; i < numberHalfEdges; i++)
+        bucketStart[std::max(polygonVertices[i], toVertices[i]) + 1]++;
+    for (unsigned int i = 0; i < numberVertices; i++)
+        bucketStart[i + 1] += bucketStart[i];
+    for (unsigned int i = 0; i < numberHalfEdges; i++)
+        byMax[bucketStart[std::max(polygonVertices[i], toVertices[i])]++] = i;
+    bucketStart.assign(numberVertices + 1, 0);
+    for (unsigned int i = 0; i < numberHalfEdges; i++)
+        bucketStart[std::min(polygonVertices[i], toVertices[i]) + 1]++;
+    for (unsigned int i = 0; i < numberVertices; i++)
+        bucketStart[i + 1] += bucketStart[i];
+    for (unsigned int i = 0; i < numberHalfEdges; i++) {
+        unsigned int h = byMax[i];
+        sorted[bucketStart[std::min(polygonVertices[h], toVertices[h])]++] = h;
+    }
+
+    // in ogni sequenza di half edge dello stesso lato, ogni half edge viene accoppiato col primo half edge opposto
+    // ancora senza twin che lo precede; i lati con più di due half edge (non manifold) lasciano senza twin quelli in più
+    std::vector<unsigned int> pendingForward, pendingBackward;
+    for (unsigned int begin = 0, end; begin < numberHalfEdges; begin = end) {
+        unsigned int first = sorted[begin];
+        end = begin + 1;
+        while (end < numberHalfEdges &&
+               std::min(polygonVertices[sorted[end]], toVertices[sorted[end]]) == std::min(polygonVertices[first], toVertices[first]) &&
+               std::max(polygonVertices[sorted[end]], toVertices[sorted[end]]) == std::max(polygonVertices[first], toVertices[first]))
+            end++;
+        pendingForward.clear();
+        pendingBackward.clear();
+        unsigned int nextForward = 0, nextBackward = 0;
+        for (unsigned int i = begin; i < end; i++) {
+            unsigned int h = sorted[i];
+            bool forward = polygonVertices[h] < toVertices[h];
+            std::vector<unsigned int>& opposite = forward ? pendingBackward : pendingForward;
+            unsigned int& nextOpposite = forward ? nextBackward : nextForward;
+            if (nextOpposite < opposite.size()) {
+                HalfEdge* twin = halfEdges[opposite[nextOpposite++]];
+                halfEdges[h]->setTwin(twin);
+                twin->setTwin(halfEdges[h]);
+            }
+            else if (polygonVertices[h] != toVertices[h]) {
+                (forward ? pendingForward : pendingBackward).push_back(h);
+            }
+        }
+    }
+}
+
+/**
+ * \~Italian
+ * @brief Costruisce l'intera Dcel a partire da un array di coordinate e da un array di triangoli indicizzati.
+ *
+ * Equivale a Dcel::buildFromIndexedPolygons con tutti i poligoni di 3 vertici.
+ *
+ * @param[in] coordinates: coordinate x y z di ogni vertice
+ * @param[in] triangles: indici dei 3 vertici di ogni triangolo, in senso antiorario
+ * @par Complessità:
+ *      \e O(numVertices \e + \e NumHalfEdges \e + \e NumFaces)
+ */
+void Dcel::buildFromIndexedTriangles(const std::vector<double>& coordinates, const std::vector<unsigned int>& triangles) {
+    std::vector<unsigned int> triangleSizes(triangles.size() / 3, 3);
+    buildFromIndexedPolygons(coordinates, triangles, triangleSizes);
+}
+
 /**
  * \~Italian
  * @brief Funzione che elimina il vertice passato in input.
@@ -639,8 +792,8 @@ bool Dcel::deleteVertex(Dcel::Vertex* v) {
         } while (he != v->incidentHalfEdge);
     }
     vertices[v->getId()]=nullptr;
-    unusedVids.insert(v->getId());
-    delete v;
+    unusedVids.push_back(v->getId());
+    vertexPool.destroy(v);
     nVertices--;
     return true;
 }
@@ -680,8 +833,8 @@ Dcel::VertexIterator Dcel::deleteVertex(const Dcel::VertexIterator& vit) {
         } while (he != v->incidentHalfEdge);
     }
     vertices[v->getId()]=nullptr;
-    unusedVids.insert(v->getId());
-    delete v;
+    unusedVids.push_back(v->getId());
+    vertexPool.destroy(v);
     nVertices--;
     return ++nv;
 }
@@ -725,8 +878,8 @@ bool Dcel::deleteHalfEdge(HalfEdge* he) {
     if (he->fromVertex != nullptr)
         if (he->fromVertex->incidentHalfEdge == he) he->fromVertex->incidentHalfEdge = nullptr;
     halfEdges[he->getId()] = nullptr;
-    unusedHeids.insert(he->getId());
-    delete he;
+    unusedHeids.push_back(he->getId());
+    halfEdgePool.destroy(he);
     nHalfEdges--;
     return true;
 }
@@ -771,8 +924,8 @@ Dcel::HalfEdgeIterator Dcel::deleteHalfEdge(const Dcel::HalfEdgeIterator& heit)
     if (he->fromVertex != nullptr)
         if (he->fromVertex->incidentHalfEdge == he) he->fromVertex->incidentHalfEdge = nullptr;
     halfEdges[he->getId()]=nullptr;
-    unusedHeids.insert(he->getId());
-    delete he;
+    unusedHeids.push_back(he->getId());
+    halfEdgePool.destroy(he);
     nHalfEdges--;
     return ++nhe;
 }
@@ -809,8 +962,8 @@ bool Dcel::deleteFace(Face* f) {
         } while (he != f->innerHalfEdges[i]);
     }
     faces[f->getId()]=nullptr;
-    unusedFids.insert(f->getId());
-    delete f;
+    unusedFids.push_back(f->getId());
+    facePool.destroy(f);
     nFaces--;
     return true;
 }
@@ -848,8 +1001,8 @@ Dcel::FaceIterator Dcel::deleteFace(const Dcel::FaceIterator& fit) {
         } while (he != f->innerHalfEdges[i]);
     }
     faces[f->getId()]=nullptr;
-    unusedFids.insert(f->getId());
-    delete f;
+    unusedFids.push_back(f->getId());
+    facePool.destroy(f);
     nFaces--;
     return ++nf;
 }
@@ -967,13 +1120,16 @@ void Dcel::resetFaceColors() {
 void Dcel::reset()	{
     for (unsigned int i=0; i<vertices.size(); i++)
         if (vertices[i] != nullptr)
-            delete vertices[i];
+            vertices[i]->~Vertex();
     for (unsigned int i=0; i<halfEdges.size(); i++)
         if (halfEdges[i] != nullptr)
-            delete halfEdges[i];
+            halfEdges[i]->~HalfEdge();
     for (unsigned int i=0; i<faces.size(); i++)
         if (faces[i] != nullptr)
-            delete faces[i];
+            faces[i]->~Face();
+    vertexPool.clear();
+    halfEdgePool.clear();
+    facePool.clear();
     vertices.clear();
     halfEdges.clear();
     faces.clear();
@@ -1258,12 +1414,9 @@ std::string Dcel::loadFromObjFile(const std::string& filename, bool regular) {
     std::ifstream file(filename.c_str());
     std::string   line;
 
-    std::vector<Vertex*> vertices;
-
-    std::map< std::pair<int,int>, HalfEdge* > edge;
-    std::map< std::pair<int,int>, HalfEdge* >::iterator eiter;
-
-    bool first = true;
+    std::vector<double> coordinates;
+    std::vector<unsigned int> polygonVertices;
+    std::vector<unsigned int> polygonSizes;
 
     if(!file.is_open())
     {
@@ -1297,26 +1450,9 @@ std::string Dcel::loadFromObjFile(const std::string& filename, bool regular) {
             ystr >> yd;
             zstr >> zd;
 
-            Pointd coord(xd, yd, zd);
-
-            if (first) {
-                boundingBox.setMin(coord);
-                boundingBox.setMax(coord);
-                first = false;
-            }
-
-            if (coord.x() < boundingBox.getMinX()) boundingBox.setMinX(coord.x());
-            if (coord.y() < boundingBox.getMinY()) boundingBox.setMinY(coord.y());
-            if (coord.z() < boundingBox.getMinZ()) boundingBox.setMinZ(coord.z());
-
-            if (coord.x() > boundingBox.getMaxX()) boundingBox.setMaxX(coord.x());
-            if (coord.y() > boundingBox.getMaxY()) boundingBox.setMaxY(coord.y());
-            if (coord.z() > boundingBox.getMaxZ()) boundingBox.setMaxZ(coord.z());
-
-            Vertex v(coord);
-            Vertex* vid = addVertex(v);
-
-            vertices.push_back(vid);
+            coordinates.push_back(xd);
+            coordinates.push_back(yd);
+            coordinates.push_back(zd);
         }
 
         // Handle
@@ -1342,60 +1478,13 @@ std::string Dcel::loadFromObjFile(const std::string& filename, bool regular) {
                 slashTokenizer.push_back(t);
             }
 
-            std::vector<int> nid;
             for (unsigned int i=0; i<slashTokenizer.size(); i++){
                 std::istringstream istr((*slashTokenizer[i].begin()).c_str());
                 int id;
                 istr >> id;
-                nid.push_back(id);
-            }
-            nid.push_back(nid[0]);
-            std::pair<int, int> p;
-            HalfEdge e;
-            HalfEdge* eid = nullptr;
-            Face f;
-            Face* fid = addFace(f);
-            HalfEdge* prev = nullptr;
-            HalfEdge* first = nullptr;
-
-            for (unsigned int i=0; i<nid.size()-1; i++){
-                eid = addHalfEdge(e);
-                if (i==0) {
-                    first = eid;
-                    fid->setOuterHalfEdge(eid);
-                }
-                else {
-                    eid->setPrev(prev);
-                    prev->setNext(eid);
-                }
-                vertices[nid[i] - 1]->setIncidentHalfEdge(eid);
-                eid->setFromVertex(vertices[nid[i] - 1]);
-                vertices[nid[i] - 1]->incrementCardinality();
-                eid->setToVertex(vertices[nid[i+1] - 1]);
-                eid->setFace(fid);
-                p.first = nid[i+1] - 1;
-                p.second = nid[i] - 1;
-                eiter = edge.find(p);
-                if (eiter != edge.end()){
-                    HalfEdge* twin = edge[p];
-                    eid->setTwin(twin);
-                    twin->setTwin(eid);
-                    edge.erase(eiter);
-                }
-                else {
-                    p.first = nid[i] - 1;
-                    p.second = nid[i+1] - 1;
-                    edge[p] = eid;
-                }
-                prev = eid;
+                polygonVertices.push_back(id - 1);
             }
-            eid->setNext(first);
-            first->setPrev(eid);
-
-            fid->setColor(QColor(128, 128, 128));
-
-            fid->updateNormal();
-            fid->updateArea();
+            polygonSizes.push_back(slashTokenizer.size());
         }
 
         // Ignore
@@ -1407,6 +1496,14 @@ std::string Dcel::loadFromObjFile(const std::string& filename, bool regular) {
 
     }
     file.close();
+
+    buildFromIndexedPolygons(coordinates, polygonVertices, polygonSizes);
+    for (unsigned int i = 0; i < faces.size(); i++){
+        faces[i]->setColor(QColor(128, 128, 128));
+        faces[i]->updateNormal();
+        faces[i]->updateArea();
+    }
+
     if (regular) updateVertexNormals();
     std::stringstream ss;
     ss << "Vertices: " << nVertices << "; Half Edges: " << nHalfEdges << "; Faces: " << nFaces << ".";
@@ -1439,16 +1536,16 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
     std::ifstream file(filename.c_str());
     std::string   line;
 
-    QVector<Vertex*> vertices;
+    std::vector<double> coordinates;
+    std::vector<unsigned int> polygonVertices;
+    std::vector<unsigned int> polygonSizes;
+    std::vector<Vec3> vertexNormals;
+    std::vector<Vec3> faceNormals;
+    std::vector<QColor> faceColors;
 
     int nVer = -1, nFac = -1;
     int nv=0, nf=0;
 
-    bool first = true;
-
-    std::map< std::pair<int,int>, HalfEdge* > edgeMap;
-    std::map< std::pair<int,int>, HalfEdge* >::iterator eiter;
-
     if(!file.is_open())
     {
         qDebug() << "ERROR : read() : could not open input file " << filename.c_str() << "\n";
@@ -1527,28 +1624,11 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                 ystr >> yd;
                 zstr >> zd;
 
-                Pointd coord(xd, yd, zd);
-
-                if (first) {
-                    boundingBox.setMin(coord);
-                    boundingBox.setMax(coord);
-                    first = false;
-                }
-
-                if (coord.x() < boundingBox.getMinX()) boundingBox.setMinX(coord.x());
-                if (coord.y() < boundingBox.getMinY()) boundingBox.setMinY(coord.y());
-                if (coord.z() < boundingBox.getMinZ()) boundingBox.setMinZ(coord.z());
-
-                if (coord.x() > boundingBox.getMaxX()) boundingBox.setMaxX(coord.x());
-                if (coord.y() > boundingBox.getMaxY()) boundingBox.setMaxY(coord.y());
-                if (coord.z() > boundingBox.getMaxZ()) boundingBox.setMaxZ(coord.z());
-
-
-                Vertex v(coord);
-                Vertex* vid = addVertex(v);
+                coordinates.push_back(xd);
+                coordinates.push_back(yd);
+                coordinates.push_back(zd);
                 nv++;
 
-                vertices.push_back(vid);
                 if (vertexOrder.first == "normal"){
                     std::string x = *(++token);
                     std::string y = *(++token);
@@ -1561,7 +1641,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                     zstr >> zd;
 
                     Vec3 norm(xd, yd, zd);
-                    vid->setNormal(norm);
+                    vertexNormals.push_back(norm);
                 }
                 if (vertexOrder.first == "color"){
                     std::string x = *(++token);
@@ -1600,7 +1680,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                     zstr >> zd;
 
                     Vec3 norm(xd, yd, zd);
-                    vid->setNormal(norm);
+                    vertexNormals.push_back(norm);
                 }
                 if (vertexOrder.second == "color"){
                     std::string x = *(++token);
@@ -1639,59 +1719,13 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                         dummy.push_back(*(token++));
                     }
 
-                    std::vector<int> nid;
                     for (int i=0; i<nvf; i++){
                         std::istringstream nstr((dummy[i]).c_str());
                         int nf;
                         nstr >> nf;
-                        nid.push_back(nf);
+                        polygonVertices.push_back(nf);
                     }
-                    nid.push_back(nid[0]);
-                    std::pair<int, int> p;
-                    HalfEdge e;
-                    HalfEdge* eid = nullptr;
-                    Face f;
-                    Face* fid = addFace(f);
-                    HalfEdge* prev = nullptr;
-                    HalfEdge* first = nullptr;
-
-                    for (unsigned int i=0; i<nid.size()-1; i++){
-                        eid = addHalfEdge(e);
-                        if (i==0) {
-                            first = eid;
-                            fid->setOuterHalfEdge(eid);
-                        }
-                        else {
-                            eid->setPrev(prev);
-                            prev->setNext(eid);
-                        }
-                        vertices[nid[i]]->setIncidentHalfEdge(eid);
-                        eid->setFromVertex(vertices[nid[i]]);
-                        vertices[nid[i]]->incrementCardinality();
-                        eid->setToVertex(vertices[nid[i+1]]);
-                        eid->setFace(fid);
-                        p.first = nid[i+1];
-                        p.second = nid[i];
-                        eiter = edgeMap.find(p);
-                        if (eiter != edgeMap.end()){
-                            HalfEdge* twin = edgeMap[p];
-                            eid->setTwin(twin);
-                            twin->setTwin(eid);
-                            edgeMap.erase(eiter);
-                        }
-                        else {
-                            p.first = nid[i];
-                            p.second = nid[i+1];
-                            edgeMap[p] = eid;
-                        }
-                        prev = eid;
-                    }
-                    eid->setNext(first);
-                    first->setPrev(eid);
-
-                    fid->updateNormal();
-                    fid->updateArea();
-                    fid->setColor(QColor(128, 128, 128));
+                    polygonSizes.push_back(nvf);
                     nf++;
                     if (faceOrder.first == "normal"){
                         std::string x = dummy[nvf];
@@ -1705,7 +1739,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                         zstr >> zd;
 
                         Vec3 norm(xd, yd, zd);
-                        fid->setNormal(norm);
+                        faceNormals.push_back(norm);
                     }
                     if (faceOrder.first == "color"){
                         std::string x = dummy[nvf];
@@ -1720,7 +1754,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                             ystr >> yd;
                             zstr >> zd;
                             QColor color(xd, yd, zd);
-                            fid->setColor(color);
+                            faceColors.push_back(color);
                         }
                         else {
                             float  xd, yd, zd;
@@ -1729,7 +1763,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                             zstr >> zd;
                             QColor color;
                             color.setRgbF(xd, yd, zd);
-                            fid->setColor(color);
+                            faceColors.push_back(color);
                         }
                     }
                     if (faceOrder.second == "normal"){
@@ -1744,7 +1778,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                         zstr >> zd;
 
                         Vec3 norm(xd, yd, zd);
-                        fid->setNormal(norm);
+                        faceNormals.push_back(norm);
                     }
                     if (faceOrder.second == "color"){
                         std::string x = dummy[nvf];
@@ -1759,7 +1793,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                             ystr >> yd;
                             zstr >> zd;
                             QColor color(xd, yd, zd);
-                            fid->setColor(color);
+                            faceColors.push_back(color);
                         }
                         else {
                             float  xd, yd, zd;
@@ -1768,7 +1802,7 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
                             zstr >> zd;
                             QColor color;
                             color.setRgbF(xd, yd, zd);
-                            fid->setColor(color);
+                            faceColors.push_back(color);
                         }
                     }
 
@@ -1777,6 +1811,18 @@ std::string Dcel::loadFromPlyFile(const std::string& filename, bool regular) {
         }
     }
     file.close();
+
+    buildFromIndexedPolygons(coordinates, polygonVertices, polygonSizes);
+    for (unsigned int i = 0; i < vertexNormals.size() && i < vertices.size(); i++){
+        vertices[i]->setNormal(vertexNormals[i]);
+    }
+    for (unsigned int i = 0; i < faces.size(); i++){
+        faces[i]->updateNormal();
+        faces[i]->updateArea();
+        faces[i]->setColor(i < faceColors.size() ? faceColors[i] : QColor(128, 128, 128));
+        if (i < faceNormals.size()) faces[i]->setNormal(faceNormals[i]);
+    }
+
     if (regular) updateVertexNormals();
     std::stringstream ss;
     ss << "Vertices: " << nVertices << "; Half Edges: " << nHalfEdges << "; Faces: " << nFaces << ".";
@@ -1945,19 +1991,19 @@ std::__cxx11::string Dcel::loadFromOldDcelFile(const std::__cxx11::string& filen
         for (int i = 0; i < nv; i++){
             int id;
             myfile.read(reinterpret_cast<char*>(&id), sizeof(int));
-            unusedVids.insert(id);
+            unusedVids.push_back(id);
         }
         myfile.read(reinterpret_cast<char*>(&nhe), sizeof(int));
         for (int i = 0; i < nhe; i++){
             int id;
             myfile.read(reinterpret_cast<char*>(&id), sizeof(int));
-            unusedHeids.insert(id);
+            unusedHeids.push_back(id);
         }
         myfile.read(reinterpret_cast<char*>(&nf), sizeof(int));
         for (int i = 0; i < nf; i++){
             int id;
             myfile.read(reinterpret_cast<char*>(&id), sizeof(int));
-            unusedFids.insert(id);
+            unusedFids.push_back(id);
         }
         //Vertices
         vertices.resize(nVertices+nv, nullptr);
@@ -2200,11 +2246,10 @@ std::string Dcel::loadFromOldOldDcelFile(const std::string& filename) {
  * @return La Dcel appena assegnata
  */
 Dcel& Dcel::operator = (const Dcel& dcel) {
-    this->~Dcel();
-    vertices.clear();
-    halfEdges.clear();
-    faces.clear();
-    copyFrom(dcel);
+    if (this != &dcel) {
+        reset();
+        copyFrom(dcel);
+    }
     return *this;
 }
 
@@ -2222,7 +2267,7 @@ Dcel& Dcel::operator = (const Dcel& dcel) {
  * @return Il puntatore al vertice appena inserito nella Dcel
  */
 Dcel::Vertex*Dcel::addVertex(int id) {
-    Vertex* last= new Vertex();
+    Vertex* last= vertexPool.create();
     last->setId(id);
     vertices[id] = last;
     return last;
@@ -2238,7 +2283,7 @@ Dcel::Vertex*Dcel::addVertex(int id) {
  * @return Il puntatore all'half edge appena inserito nella Dcel
  */
 Dcel::HalfEdge*Dcel::addHalfEdge(int id) {
-    HalfEdge* last = new HalfEdge();
+    HalfEdge* last = halfEdgePool.create();
     last->setId(id);
     halfEdges[id] = last;
     return last;
@@ -2254,7 +2299,7 @@ Dcel::HalfEdge*Dcel::addHalfEdge(int id) {
  * @return Il puntatore alla faccia appena inserita nella Dcel
  */
 Dcel::Face*Dcel::addFace(int id) {
-    Face* last = new Face();
+    Face* last = facePool.create();
     last->setId(id);
     faces[id] = last;
     return last;
@@ -2352,7 +2397,8 @@ std::vector<const Dcel::Vertex*> Dcel::makeSingleBorder(const Face* f) const {
  *
  * Nessuno degli elementi contenuti nella Dcel d viene copiato per riferimento ma per valore,
  * e vengono ricostruite tutte le relazioni tra i nuovi elementi.
- * Vengono preservati gli id degli elementi.
+ * Vengono preservati gli id degli elementi: le liste vengono allocate una sola volta con la dimensione
+ * di quelle di d, e ogni elemento di d viene ritrovato in tempo costante mediante il suo id.
  *
  * @param d: Dcel da cui verrà fatta la copia
  */
@@ -2364,59 +2410,53 @@ void Dcel::copyFrom(const Dcel &d) {
     this->nHalfEdges = d.nHalfEdges;
     this->nFaces = d.nFaces;
     this->boundingBox = d.boundingBox;
-    std::map<const Dcel::Vertex*, Dcel::Vertex*> mapVertices;
-    std::map<const Dcel::HalfEdge*, Dcel::HalfEdge*> mapHalfEdges;
-    std::map<const Dcel::Face*, Dcel::Face*> mapFaces;
+    this->vertexPool.reserve(d.nVertices);
+    this->halfEdgePool.reserve(d.nHalfEdges);
+    this->facePool.reserve(d.nFaces);
     this->vertices.resize(d.vertices.size(), nullptr);
     for (Dcel::ConstVertexIterator vit = d.vertexBegin(); vit != d.vertexEnd(); ++vit) {
         const Dcel::Vertex* ov = *vit;
         Dcel::Vertex* v = this->addVertex(ov->getId());
-        v->setId(ov->getId());
         v->setCoordinate(ov->getCoordinate());
         v->setFlag(ov->getFlag());
         v->setCardinality(ov->getCardinality());
         v->setNormal(ov->getNormal());
-        mapVertices[ov] = v;
     }
 
     this->halfEdges.resize(d.halfEdges.size(), nullptr);
     for (Dcel::ConstHalfEdgeIterator heit = d.halfEdgeBegin(); heit != d.halfEdgeEnd(); ++heit) {
         const Dcel::HalfEdge* ohe = *heit;
         Dcel::HalfEdge* he = this->addHalfEdge(ohe->getId());
-        he->setId(ohe->getId());
         he->setFlag(ohe->getFlag());
-        he->setFromVertex(mapVertices[ohe->getFromVertex()]);
-        he->setToVertex(mapVertices[ohe->getToVertex()]);
-        mapHalfEdges[ohe] = he;
+        if (ohe->getFromVertex() != nullptr) he->setFromVertex(this->vertices[ohe->getFromVertex()->getId()]);
+        if (ohe->getToVertex() != nullptr) he->setToVertex(this->vertices[ohe->getToVertex()->getId()]);
     }
 
     this->faces.resize(d.faces.size(), nullptr);
     for (Dcel::ConstFaceIterator fit = d.faceBegin(); fit != d.faceEnd(); ++fit){
         const Dcel::Face* of = *fit;
         Dcel::Face* f = this->addFace(of->getId());
-        f->setId(of->getId());
         f->setColor(of->getColor());
         f->setFlag(of->getFlag());
         f->setNormal(of->getNormal());
         f->setArea(of->getArea());
-        f->setOuterHalfEdge(mapHalfEdges[of->getOuterHalfEdge()]);
-        for (Dcel::Face::ConstInnerHalfEdgeIterator heit = f->innerHalfEdgeBegin(); heit != f->innerHalfEdgeEnd(); ++heit){
-            f->addInnerHalfEdge(mapHalfEdges[*heit]);
+        if (of->getOuterHalfEdge() != nullptr) f->setOuterHalfEdge(this->halfEdges[of->getOuterHalfEdge()->getId()]);
+        for (Dcel::Face::ConstInnerHalfEdgeIterator heit = of->innerHalfEdgeBegin(); heit != of->innerHalfEdgeEnd(); ++heit){
+            f->addInnerHalfEdge(this->halfEdges[(*heit)->getId()]);
         }
-        mapFaces[of] = f;
     }
 
     for (Dcel::ConstHalfEdgeIterator heit = d.halfEdgeBegin(); heit != d.halfEdgeEnd(); ++heit) {
         const Dcel::HalfEdge* ohe = *heit;
-        Dcel::HalfEdge* he = mapHalfEdges[ohe];
-        he->setNext(mapHalfEdges[ohe->getNext()]);
-        he->setPrev(mapHalfEdges[ohe->getPrev()]);
-        he->setTwin(mapHalfEdges[ohe->getTwin()]);
-        he->setFace(mapFaces[ohe->getFace()]);
+        Dcel::HalfEdge* he = this->halfEdges[ohe->getId()];
+        if (ohe->getNext() != nullptr) he->setNext(this->halfEdges[ohe->getNext()->getId()]);
+        if (ohe->getPrev() != nullptr) he->setPrev(this->halfEdges[ohe->getPrev()->getId()]);
+        if (ohe->getTwin() != nullptr) he->setTwin(this->halfEdges[ohe->getTwin()->getId()]);
+        if (ohe->getFace() != nullptr) he->setFace(this->faces[ohe->getFace()->getId()]);
     }
 
     for (Dcel::ConstVertexIterator vit = d.vertexBegin(); vit != d.vertexEnd(); ++vit) {
-        Dcel::Vertex * v = mapVertices[*vit];
-        v->setIncidentHalfEdge(mapHalfEdges[(*vit)->getIncidentHalfEdge()]);
+        const Dcel::Vertex* ov = *vit;
+        if (ov->getIncidentHalfEdge() != nullptr) this->vertices[ov->getId()]->setIncidentHalfEdge(this->halfEdges[ov->getIncidentHalfEdge()->getId()]);
     }
 }
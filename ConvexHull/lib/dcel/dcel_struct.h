@@ -15,6 +15,7 @@
 #include <array>
 
 #include "lib/common/bounding_box.h"
+#include "dcel_pool.h"
 
 /**
  * \~Italian
@@ -132,6 +133,8 @@ class Dcel : public SerializableObject {
         HalfEdge* addHalfEdge(const HalfEdge& he);
         Face* addFace();
         Face* addFace(const Face& f);
+        void buildFromIndexedPolygons(const std::vector<double>& coordinates, const std::vector<unsigned int>& polygonVertices, const std::vector<unsigned int>& polygonSizes);
+        void buildFromIndexedTriangles(const std::vector<double>& coordinates, const std::vector<unsigned int>& triangles);
         bool deleteVertex (Vertex* v);
         VertexIterator deleteVertex(const VertexIterator& vit);
         bool deleteHalfEdge (HalfEdge* he);
@@ -165,13 +168,16 @@ class Dcel : public SerializableObject {
         std::vector<Vertex* >   vertices;       /**< \~Italian @brief Lista di vertici della Dcel. */
         std::vector<HalfEdge* > halfEdges;      /**< \~Italian @brief Lista di half edge della Dcel. */
         std::vector<Face* >     faces;          /**< \~Italian @brief Lista di facce della Dcel. */
-        std::set<int>           unusedVids;     /**< \~Italian @brief Insieme degli id dei vertici non utilizzati (nullptr). */
-        std::set<int>           unusedHeids;    /**< \~Italian @brief Insieme degli id degli half edge non utilizzati (nullptr). */
-        std::set<int>           unusedFids;     /**< \~Italian @brief Insieme degli id delle facce non utilizzati (nullptr). */
+        std::vector<int>        unusedVids;     /**< \~Italian @brief Pila degli id dei vertici non utilizzati (nullptr), l'ultimo è il primo ad essere riutilizzato. */
+        std::vector<int>        unusedHeids;    /**< \~Italian @brief Pila degli id degli half edge non utilizzati (nullptr), l'ultimo è il primo ad essere riutilizzato. */
+        std::vector<int>        unusedFids;     /**< \~Italian @brief Pila degli id delle facce non utilizzati (nullptr), l'ultimo è il primo ad essere riutilizzato. */
         unsigned int            nVertices;      /**< \~Italian @brief Prossimo id del vertice. */
         unsigned int            nHalfEdges;     /**< \~Italian @brief Prossimo id dell'half edge. */
         unsigned int            nFaces;         /**< \~Italian @brief Prossimo id della faccia. */
         BoundingBox             boundingBox;    /**< \~Italian @brief Bounding box della mesh. */
+        DcelPool<Vertex>        vertexPool;     /**< \~Italian @brief Blocchi di memoria dei vertici della Dcel. */
+        DcelPool<HalfEdge>      halfEdgePool;   /**< \~Italian @brief Blocchi di memoria degli half edge della Dcel. */
+        DcelPool<Face>          facePool;       /**< \~Italian @brief Blocchi di memoria delle facce della Dcel. */
 
         /******************
         * Private Methods *
@@ -0,0 +1,218 @@
+#include "parallelconvexhullbuilder.h"
+#include <algorithm>
+
+/**
+ * @brief ParallelConvexHullBuilder::ParallelConvexHullBuilder()
+ * @params Dcel *dcel, ConvexHullBuilder::Strategy strategy used by the builder of each chunk and by the final one
+ */
+ParallelConvexHullBuilder::ParallelConvexHullBuilder(Dcel *dcel, ConvexHullBuilder::Strategy strategy){
+    this->dcel = dcel;
+    this->strategy = strategy;
+    this->numberOfThreads = std::thread::hardware_concurrency();
+    this->prefilter = false;
+    this->seed = std::random_device()();
+    this->statisticsOutput = nullptr;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder Class Destructor
+ **/
+ParallelConvexHullBuilder::~ParallelConvexHullBuilder(){
+    chunks.clear();
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads)
+ *        Sets the number of chunks, each one built on its own thread.
+ *        Defaults to the number of hardware threads.
+ * @param unsigned int const &numberOfThreads, 0 means number of hardware threads
+ */
+void ParallelConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads){
+    this->numberOfThreads = numberOfThreads > 0 ? numberOfThreads : std::thread::hardware_concurrency();
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::setPrefilter(bool const &prefilter)
+ *        Enables the prefilter of each chunk builder and of the final one (see ConvexHullBuilder::setPrefilter)
+ * @param bool const &prefilter
+ */
+void ParallelConvexHullBuilder::setPrefilter(bool const &prefilter){
+    this->prefilter = prefilter;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::setSeed(unsigned int const &seed)
+ *        Sets the seed of the chunk builders and of the final one, the same seed on the same input builds
+ *        the very same hull whatever the scheduling of the threads. A random seed is used by default.
+ * @param unsigned int const &seed
+ */
+void ParallelConvexHullBuilder::setSeed(unsigned int const &seed){
+    this->seed = seed;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput)
+ *        The counters of all the builders (see HullStatistics) are added up and written as JSON on the stream at the
+ *        end of each computeConvexHull(). The vertices of the chunk hulls are given again to the final build, so they
+ *        are counted as reused points. Nothing is written by default.
+ * @param std::ostream* statisticsOutput, nullptr to stop writing
+ */
+void ParallelConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput){
+    this->statisticsOutput = statisticsOutput;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::computeConvexHull()
+ *        - Takes all the vertices from the Dcel
+ *        - Splits them in spatial chunks, one per thread
+ *        - Builds the hull of each chunk on its own thread, keeping only the vertices of the chunk hull
+ *        - Builds the hull of the union of the chunk hull vertices in the dcel
+ *        Small inputs are not split at all, the dcel is built by a single ConvexHullBuilder.
+ * @return false if the vertices have no hull (see ConvexHullBuilder::computeConvexHull)
+ */
+bool ParallelConvexHullBuilder::computeConvexHull(){
+
+    //Get all the vertices from the dcel
+    std::vector<Pointd> points;
+    points.reserve(dcel->getNumberVertices());
+    for(auto vertexIterator = dcel->vertexBegin(); vertexIterator != dcel->vertexEnd(); vertexIterator++){
+        points.push_back((*vertexIterator)->getCoordinate());
+    }
+
+    //Chunks too small are not worth a thread
+    const unsigned int minPointsPerChunk = 4096;
+    unsigned int chunksNumber = std::min(numberOfThreads, (unsigned int) points.size() / minPointsPerChunk);
+    hullStatistics.reset();
+
+    if( chunksNumber > 1 ){
+        splitInChunks(points, chunksNumber);
+        chunkStatistics.assign(chunksNumber, HullStatistics());
+
+        //Build the hull of each chunk, the first one on the current thread
+        std::vector<std::thread> threads;
+        for(unsigned int c = 1; c < chunksNumber; c++){
+            threads.push_back(std::thread(&ParallelConvexHullBuilder::buildChunkHull, this, c));
+        }
+        buildChunkHull(0);
+        for(auto threadIterator = threads.begin(); threadIterator != threads.end(); threadIterator++){
+            threadIterator->join();
+        }
+
+        //Only the vertices of the chunk hulls are left
+        points.clear();
+        for(auto chunkIterator = chunks.begin(); chunkIterator != chunks.end(); chunkIterator++){
+            points.insert(points.end(), chunkIterator->begin(), chunkIterator->end());
+        }
+        chunks.clear();
+
+        //The vertices of the chunk hulls are given again to the final build
+        for(auto statisticsIterator = chunkStatistics.begin(); statisticsIterator != chunkStatistics.end(); statisticsIterator++){
+            hullStatistics.add(*statisticsIterator);
+        }
+        hullStatistics.pointsReused += points.size();
+    }
+
+    //Final hull, built in the dcel
+    ConvexHullBuilder convexHullBuilder(dcel, strategy);
+    convexHullBuilder.setNumberOfThreads(numberOfThreads);
+    convexHullBuilder.setPrefilter(prefilter);
+    convexHullBuilder.setSeed(seed);
+    bool built = convexHullBuilder.computeConvexHull(packCoordinates(points));
+
+    hullStatistics.add(convexHullBuilder.getStatistics());
+    if( statisticsOutput != nullptr ){
+        *statisticsOutput << hullStatistics.toJson() << std::endl;
+    }
+    return built;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::getStatistics() const
+ * @return HullStatistics const & counters of the last computeConvexHull, all the builders included
+ */
+HullStatistics const & ParallelConvexHullBuilder::getStatistics() const{
+    return hullStatistics;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::packCoordinates(std::vector<Pointd> const &points)
+ *        Packs the coordinates of the points in the layout taken by ConvexHullBuilder::computeConvexHull
+ * @param  std::vector<Pointd> const &points
+ * @return std::vector<double> x y z of each point
+ */
+std::vector<double> ParallelConvexHullBuilder::packCoordinates(std::vector<Pointd> const &points){
+    std::vector<double> coordinates;
+    coordinates.reserve(points.size() * 3);
+    for(auto pointIterator = points.begin(); pointIterator != points.end(); pointIterator++){
+        coordinates.push_back(pointIterator->x());
+        coordinates.push_back(pointIterator->y());
+        coordinates.push_back(pointIterator->z());
+    }
+    return coordinates;
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::splitInChunks(std::vector<Pointd> &points, unsigned int const &chunksNumber)
+ *        Splits the points in slabs with the same number of points along the longest side of their bounding box
+ * @param std::vector<Pointd> &points, reordered, unsigned int const &chunksNumber
+ */
+void ParallelConvexHullBuilder::splitInChunks(std::vector<Pointd> &points, unsigned int const &chunksNumber){
+
+    //Longest side of the bounding box
+    Pointd min = points[0], max = points[0];
+    for(auto pointIterator = points.begin(); pointIterator != points.end(); pointIterator++){
+        min = min.min(*pointIterator);
+        max = max.max(*pointIterator);
+    }
+    Pointd size = max - min;
+    unsigned int axis = 0;
+    if( size.y() > size.x() && size.y() >= size.z() ){
+        axis = 1;
+    } else if( size.z() > size.x() && size.z() > size.y() ){
+        axis = 2;
+    }
+
+    //Partition the points around the boundary of each slab
+    auto compareOnAxis = [axis](Pointd const &a, Pointd const &b){
+        return axis == 0 ? a.x() < b.x() : (axis == 1 ? a.y() < b.y() : a.z() < b.z());
+    };
+    std::vector<Pointd>::iterator chunkBegin = points.begin();
+    chunks.resize(chunksNumber);
+    for(unsigned int c = 0; c < chunksNumber; c++){
+        std::vector<Pointd>::iterator chunkEnd = points.begin() + (unsigned long long) points.size() * (c+1) / chunksNumber;
+        if( chunkEnd != points.end() ){
+            std::nth_element(chunkBegin, chunkEnd, points.end(), compareOnAxis);
+        }
+        chunks[c].assign(chunkBegin, chunkEnd);
+        chunkBegin = chunkEnd;
+    }
+}
+
+/**
+ * @brief ParallelConvexHullBuilder::buildChunkHull(unsigned int const &chunkIndex)
+ *        Builds the hull of a chunk in a dcel of its own and replaces the points of the chunk with the hull vertices.
+ *        A flat chunk has no hull, its points are all kept.
+ *        Each chunk has its own seed, derived from the one of this builder.
+ *        Only touches the passed chunk, so it can run concurrently on different chunks.
+ * @param unsigned int const &chunkIndex
+ */
+void ParallelConvexHullBuilder::buildChunkHull(unsigned int const &chunkIndex){
+    std::vector<Pointd> &chunk = chunks[chunkIndex];
+
+    //One thread per chunk is already running
+    Dcel chunkDcel;
+    ConvexHullBuilder convexHullBuilder(&chunkDcel, strategy);
+    convexHullBuilder.setNumberOfThreads(1);
+    convexHullBuilder.setPrefilter(prefilter);
+    convexHullBuilder.setSeed(seed + chunkIndex + 1);
+    bool built = convexHullBuilder.computeConvexHull(packCoordinates(chunk));
+    chunkStatistics[chunkIndex] = convexHullBuilder.getStatistics();
+    if( !built ){
+        return;
+    }
+
+    chunk.clear();
+    for(auto vertexIterator = chunkDcel.vertexBegin(); vertexIterator != chunkDcel.vertexEnd(); vertexIterator++){
+        chunk.push_back((*vertexIterator)->getCoordinate());
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef PARALLELCONVEXHULLBUILDER_H
+#define PARALLELCONVEXHULLBUILDER_H
+
+#include <vector>
+#include <thread>
+#include <lib/dcel/dcel.h>
+
+#include "convexhullbuilder.h"
+
+/**
+ * @brief ParallelConvexHullBuilder
+ *        Divide and conquer convex hull: the vertices of the dcel are split in spatial chunks (slabs along the
+ *        longest side of the bounding box), the hull of each chunk is built by its own ConvexHullBuilder on its
+ *        own thread, then the final hull is built from the union of the vertices of the chunk hulls only.
+ *        A vertex inside its chunk hull is inside the whole hull, so it never reaches the merge step.
+ */
+class ParallelConvexHullBuilder{
+
+public:
+    ParallelConvexHullBuilder(Dcel* dcel, ConvexHullBuilder::Strategy strategy = ConvexHullBuilder::RANDOMIZED_INCREMENTAL); //Constructor Declaration
+    ~ParallelConvexHullBuilder(); //Destructor Declaration
+    void setNumberOfThreads(unsigned int const &numberOfThreads);
+    void setPrefilter(bool const &prefilter);
+    void setSeed(unsigned int const &seed);
+    void setStatisticsOutput(std::ostream* statisticsOutput);
+    bool computeConvexHull();
+    HullStatistics const & getStatistics() const;
+
+private:
+    Dcel                        *dcel;
+    ConvexHullBuilder::Strategy strategy;
+    unsigned int                numberOfThreads;
+    bool                        prefilter;
+    unsigned int                seed;
+    std::ostream                *statisticsOutput;
+    /** Counters of the last computeConvexHull: the ones of the chunk builders plus the ones of the final build **/
+    HullStatistics              hullStatistics;
+    /** Counters of the builder of each chunk, each one written by its own thread **/
+    std::vector<HullStatistics> chunkStatistics;
+    /** Points of each chunk, replaced by the vertices of the chunk hull once it has been built **/
+    std::vector< std::vector<Pointd> > chunks;
+
+    void splitInChunks(std::vector<Pointd> &points, unsigned int const &chunksNumber);
+    void buildChunkHull(unsigned int const &chunkIndex);
+    static std::vector<double> packCoordinates(std::vector<Pointd> const &points);
+};
+
+#endif // PARALLELCONVEXHULLBUILDER_H
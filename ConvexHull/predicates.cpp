@@ -0,0 +1,21 @@
+#include "predicates.h"
+#include <gmpxx.h>
+
+/**
+ * @brief orient3dExact(Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d)
+ *        Exact version of orient3d, called only when the floating point filter cannot decide.
+ *        Each double is a rational number, so the determinant is computed with no rounding at all with GMP rationals.
+ * @param  Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d
+ * @return int 1 if d is in front of the plane through a, b, c, -1 if behind, 0 if coplanar
+ */
+int orient3dExact(Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d){
+    mpq_class adx = mpq_class(a.x()) - d.x(), ady = mpq_class(a.y()) - d.y(), adz = mpq_class(a.z()) - d.z();
+    mpq_class bdx = mpq_class(b.x()) - d.x(), bdy = mpq_class(b.y()) - d.y(), bdz = mpq_class(b.z()) - d.z();
+    mpq_class cdx = mpq_class(c.x()) - d.x(), cdy = mpq_class(c.y()) - d.y(), cdz = mpq_class(c.z()) - d.z();
+
+    mpq_class det = adz * (bdx * cdy - cdx * bdy)
+                  + bdz * (cdx * ady - adx * cdy)
+                  + cdz * (adx * bdy - bdx * ady);
+
+    return -sgn(det);
+}
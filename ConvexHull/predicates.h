@@ -0,0 +1,46 @@
+#ifndef PREDICATES_H
+#define PREDICATES_H
+
+#include <cmath>
+#include <limits>
+#include "lib/common/point.h"
+
+int orient3dExact(Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d);
+
+/**
+ * @brief orient3d(Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d)
+ *        Sign of the volume of the tetrahedron a, b, c, d: positive if d lies in front of the plane through a, b, c
+ *        (the side where a, b, c are seen counter-clockwise), negative if behind, 0 if the four points are coplanar.
+ *        The determinant is computed with doubles and trusted if it is greater than its worst rounding error
+ *        (the forward error bound of Shewchuk's orient3d filter), otherwise it is computed exactly with GMP.
+ * @param  Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d
+ * @return int 1, -1 or 0
+ */
+inline int orient3d(Pointd const &a, Pointd const &b, Pointd const &c, Pointd const &d){
+    double adx = a.x() - d.x(), ady = a.y() - d.y(), adz = a.z() - d.z();
+    double bdx = b.x() - d.x(), bdy = b.y() - d.y(), bdz = b.z() - d.z();
+    double cdx = c.x() - d.x(), cdy = c.y() - d.y(), cdz = c.z() - d.z();
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    //det[a-d; b-d; c-d] is minus the volume, d in front of a, b, c gives a negative value
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+
+    double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz)
+                     + (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz)
+                     + (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+    const double epsilon = std::numeric_limits<double>::epsilon() / 2;
+    const double errorBound = (7.0 + 56.0 * epsilon) * epsilon * permanent;
+
+    if( det > errorBound ){
+        return -1;
+    }
+    if( -det > errorBound ){
+        return 1;
+    }
+    return orient3dExact(a, b, c, d);
+}
+
+#endif // PREDICATES_H
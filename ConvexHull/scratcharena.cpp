@@ -0,0 +1,58 @@
+#include "scratcharena.h"
+
+/**
+ * @brief ScratchArena::ScratchArena() Class Constructor, buffers start empty and grow with the first insertions
+ */
+ScratchArena::ScratchArena(){
+    this->peakBytes = 0;
+}
+
+/**
+ * @brief ScratchArena Class Destructor
+ **/
+ScratchArena::~ScratchArena(){}
+
+/**
+ * @brief ScratchArena::reset()
+ *        Empties all the buffers at the end of an insertion, keeping their capacity,
+ *        and updates the peak of the bytes used by a single insertion
+ */
+void ScratchArena::reset(){
+    std::size_t usedBytes = getUsedBytes();
+    if( usedBytes > peakBytes ){
+        peakBytes = usedBytes;
+    }
+
+    visibleFaces.clear();
+    facesToVisit.clear();
+    notVisibleFaces.clear();
+    horizon.clear();
+    candidateVertices.clear();
+    newFaces.clear();
+}
+
+/**
+ * @brief ScratchArena::getPeakBytes()
+ * @return std::size_t greatest number of bytes used by the temporaries of a single insertion
+ */
+std::size_t ScratchArena::getPeakBytes() const{
+    return peakBytes;
+}
+
+/**
+ * @brief ScratchArena::getReservedBytes()
+ * @return std::size_t bytes currently reserved by the buffers, they are never given back until the arena is deleted
+ */
+std::size_t ScratchArena::getReservedBytes() const{
+    return ( visibleFaces.capacity() + facesToVisit.capacity() + notVisibleFaces.capacity() + horizon.capacity()
+           + candidateVertices.capacity() + newFaces.capacity() ) * sizeof(unsigned int);
+}
+
+/**
+ * @brief ScratchArena::getUsedBytes()
+ * @return std::size_t bytes used by the current content of the buffers
+ */
+std::size_t ScratchArena::getUsedBytes() const{
+    return ( visibleFaces.size() + facesToVisit.size() + notVisibleFaces.size() + horizon.size()
+           + candidateVertices.size() + newFaces.size() ) * sizeof(unsigned int);
+}
@@ -0,0 +1,40 @@
+#ifndef SCRATCHARENA_H
+#define SCRATCHARENA_H
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief ScratchArena
+ *        Owns every temporary container needed to insert one vertex in the hull: the visibility search,
+ *        the horizon, the candidate vertices and the new faces.
+ *        ConvexHullBuilder resets it after each insertion: the buffers only hold indices, so
+ *        clearing them just moves their end back in constant time and keeps their capacity for the next vertex.
+ *        After the first insertions no more memory is allocated, the reserved memory is bounded by the
+ *        largest single insertion instead of growing with the number of inserted vertices.
+ */
+class ScratchArena{
+
+public:
+    ScratchArena();
+    ~ScratchArena(); //Destructor Declaration
+
+    void reset();
+    std::size_t getPeakBytes() const;
+    std::size_t getReservedBytes() const;
+
+    std::vector<unsigned int> visibleFaces;      //Faces visible by the current vertex, in the order they are found
+    std::vector<unsigned int> facesToVisit;      //Stack of the visibility search
+    std::vector<unsigned int> notVisibleFaces;   //Faces tested and found not visible
+    std::vector<unsigned int> horizon;           //Half-edges of the horizon of the current vertex, in cyclic order
+    std::vector<unsigned int> candidateVertices; //Vertices in conflict with the visible faces
+    std::vector<unsigned int> newFaces;          //Faces built between the current vertex and the horizon
+
+private:
+    /** Greatest number of bytes used by a single insertion **/
+    std::size_t peakBytes;
+
+    std::size_t getUsedBytes() const;
+};
+
+#endif // SCRATCHARENA_H
@@ -0,0 +1,193 @@
+#include "streamingconvexhullbuilder.h"
+#include <fstream>
+#include <cstdlib>
+#include <utility>
+
+/**
+ * @brief StreamingConvexHullBuilder::StreamingConvexHullBuilder()
+ *        The hull is built in the passed dcel, the chunks hold 2^20 (1048576) points by default
+ * @params Dcel *dcel, ConvexHullBuilder::Strategy strategy used to insert the points of each chunk
+ */
+StreamingConvexHullBuilder::StreamingConvexHullBuilder(Dcel *dcel, ConvexHullBuilder::Strategy strategy){
+    this->dcel = dcel;
+    this->strategy = strategy;
+    this->numberOfThreads = 0;
+    this->prefilter = false;
+    this->seeded = false;
+    this->seed = 0;
+    this->chunkSize = 1 << 20;
+    this->numberPoints = 0;
+    this->timerTree = nullptr;
+    this->statisticsOutput = nullptr;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder Class Destructor
+ **/
+StreamingConvexHullBuilder::~StreamingConvexHullBuilder(){}
+
+/**
+ * @brief StreamingConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads)
+ *        Sets the number of threads of the builder (see ConvexHullBuilder::setNumberOfThreads)
+ * @param unsigned int const &numberOfThreads, 0 means number of hardware threads
+ */
+void StreamingConvexHullBuilder::setNumberOfThreads(unsigned int const &numberOfThreads){
+    this->numberOfThreads = numberOfThreads;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::setPrefilter(bool const &prefilter)
+ *        Enables the prefilter of the builder (see ConvexHullBuilder::setPrefilter), it is applied each time
+ *        the hull is built again on the hull vertices and a new chunk
+ * @param bool const &prefilter
+ */
+void StreamingConvexHullBuilder::setPrefilter(bool const &prefilter){
+    this->prefilter = prefilter;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::setSeed(unsigned int const &seed)
+ *        Sets the seed of the builder, the same seed and chunk size on the same file build the very same hull.
+ *        A random seed is used by default.
+ * @param unsigned int const &seed
+ */
+void StreamingConvexHullBuilder::setSeed(unsigned int const &seed){
+    this->seed = seed;
+    this->seeded = true;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::setChunkSize(unsigned int const &chunkSize)
+ *        Sets the number of points read before they are folded into the hull.
+ *        Larger chunks are folded faster, smaller ones take less memory.
+ * @param unsigned int const &chunkSize, at least 1
+ */
+void StreamingConvexHullBuilder::setChunkSize(unsigned int const &chunkSize){
+    this->chunkSize = chunkSize > 0 ? chunkSize : 1;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::setTimerTree(TimerTree* timerTree)
+ *        Times the reading of the file and the phases of the builder (see ConvexHullBuilder::setTimerTree),
+ *        the ones of all the chunks add up. Nothing is timed by default.
+ * @param TimerTree* timerTree, nullptr to stop timing
+ */
+void StreamingConvexHullBuilder::setTimerTree(TimerTree* timerTree){
+    this->timerTree = timerTree;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput)
+ *        The counters of the builder (see HullStatistics) are written as JSON on the stream once the whole file
+ *        has been folded, the ones of all the chunks add up. Nothing is written by default.
+ * @param std::ostream* statisticsOutput, nullptr to stop writing
+ */
+void StreamingConvexHullBuilder::setStatisticsOutput(std::ostream* statisticsOutput){
+    this->statisticsOutput = statisticsOutput;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::computeConvexHull(std::string const &filename)
+ *        Reads the vertices of the OBJ file and builds their hull in the dcel, whatever the dcel contains is discarded.
+ *        - Collects the coordinates of the next chunkSize "v" lines
+ *        - Inserts them in the hull of the previous chunks, only the vertices of the new hull are kept
+ *        - Goes on until the end of the file, then folds the last partial chunk
+ *        Each chunk is read in a buffer with room for the hull vertices too, which the builder takes over instead of
+ *        copying it (see ConvexHullBuilder::insertPoints), so the coordinates in memory are at most one chunk plus the hull.
+ * @param  std::string const &filename path of the OBJ file
+ * @return false if the file cannot be read or its vertices have no hull (see ConvexHullBuilder::computeConvexHull):
+ *         the dcel is left empty
+ */
+bool StreamingConvexHullBuilder::computeConvexHull(std::string const &filename){
+    dcel->reset();
+    numberPoints = 0;
+    hullStatistics.reset();
+
+    std::ifstream file(filename.c_str());
+    if( !file.is_open() ){
+        return false;
+    }
+
+    ConvexHullBuilder convexHullBuilder(dcel, strategy);
+    convexHullBuilder.setNumberOfThreads(numberOfThreads);
+    convexHullBuilder.setPrefilter(prefilter);
+    if( seeded ) convexHullBuilder.setSeed(seed);
+    convexHullBuilder.setTimerTree(timerTree);
+
+    std::vector<double> chunk;
+    chunk.reserve((std::size_t) chunkSize * 3 + dcel->getNumberVertices() * 3);
+
+    bool built = false;
+    std::string line;
+    double coordinates[3];
+    ScopedTimer loadTimer(timerTree, "Load");
+    while( std::getline(file, line) ){
+        if( !parseVertex(line, coordinates) ){
+            continue;
+        }
+        chunk.insert(chunk.end(), coordinates, coordinates + 3);
+        numberPoints++;
+
+        //Fold the full chunk into the hull, its interior points are dropped
+        if( chunk.size() == (std::size_t) chunkSize * 3 ){
+            loadTimer.stop();
+            built = convexHullBuilder.insertPoints(std::move(chunk));
+            chunk.reserve((std::size_t) chunkSize * 3 + dcel->getNumberVertices() * 3);
+            loadTimer.start();
+        }
+    }
+    loadTimer.stop();
+
+    //Last partial chunk
+    if( !chunk.empty() ){
+        built = convexHullBuilder.insertPoints(std::move(chunk));
+    }
+
+    hullStatistics = convexHullBuilder.getStatistics();
+    if( statisticsOutput != nullptr ){
+        *statisticsOutput << hullStatistics.toJson() << std::endl;
+    }
+    return built;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::getNumberPoints() const
+ * @return unsigned long long number of vertices read from the file by the last computeConvexHull
+ */
+unsigned long long StreamingConvexHullBuilder::getNumberPoints() const{
+    return numberPoints;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::getStatistics() const
+ * @return HullStatistics const & counters of the last computeConvexHull, all the chunks included
+ */
+HullStatistics const & StreamingConvexHullBuilder::getStatistics() const{
+    return hullStatistics;
+}
+
+/**
+ * @brief StreamingConvexHullBuilder::parseVertex(std::string const &line, double coordinates[3])
+ *        Parses a vertex line of an OBJ file, "v x y z" with an optional w which is ignored.
+ *        Normals (vn), texture coordinates (vt), faces and any other line are not vertices.
+ * @param  std::string const &line, double coordinates[3] set to x, y and z of the vertex
+ * @return true if the line is a vertex with three coordinates
+ */
+bool StreamingConvexHullBuilder::parseVertex(std::string const &line, double coordinates[3]){
+    //Skip leading blanks
+    std::size_t first = line.find_first_not_of(" \t");
+    if( first == std::string::npos || line[first] != 'v' || first + 1 >= line.size() || (line[first + 1] != ' ' && line[first + 1] != '\t') ){
+        return false;
+    }
+
+    const char *begin = line.c_str() + first + 1;
+    for(unsigned int i = 0; i < 3; i++){
+        char *end;
+        coordinates[i] = std::strtod(begin, &end);
+        if( end == begin ){
+            return false;
+        }
+        begin = end;
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+#ifndef STREAMINGCONVEXHULLBUILDER_H
+#define STREAMINGCONVEXHULLBUILDER_H
+
+#include <string>
+#include <vector>
+#include <lib/dcel/dcel.h>
+
+#include "convexhullbuilder.h"
+
+/**
+ * @brief StreamingConvexHullBuilder
+ *        Out of core convex hull of the vertices of an OBJ file: the file is read one line at a time and only the
+ *        vertex coordinates are kept, in chunks of a fixed number of points. Each full chunk is folded into the hull
+ *        of the previous ones (see ConvexHullBuilder::insertPoints), which keeps only its vertices.
+ *        Faces, normals and texture coordinates of the file are skipped, no Dcel of the input is ever built,
+ *        so the memory used is bounded by the size of the hull plus one chunk, whatever the size of the file.
+ */
+class StreamingConvexHullBuilder{
+
+public:
+    StreamingConvexHullBuilder(Dcel* dcel, ConvexHullBuilder::Strategy strategy = ConvexHullBuilder::RANDOMIZED_INCREMENTAL); //Constructor Declaration
+    ~StreamingConvexHullBuilder(); //Destructor Declaration
+    void setNumberOfThreads(unsigned int const &numberOfThreads);
+    void setPrefilter(bool const &prefilter);
+    void setSeed(unsigned int const &seed);
+    void setChunkSize(unsigned int const &chunkSize);
+    void setTimerTree(TimerTree* timerTree);
+    void setStatisticsOutput(std::ostream* statisticsOutput);
+    bool computeConvexHull(std::string const &filename);
+    unsigned long long getNumberPoints() const;
+    HullStatistics const & getStatistics() const;
+
+private:
+    Dcel                        *dcel;
+    ConvexHullBuilder::Strategy strategy;
+    unsigned int                numberOfThreads;
+    bool                        prefilter;
+    bool                        seeded;
+    unsigned int                seed;
+    unsigned int                chunkSize;
+    TimerTree                   *timerTree;
+    std::ostream                *statisticsOutput;
+    /** Counters of the builder at the end of the last computeConvexHull, all the chunks included **/
+    HullStatistics              hullStatistics;
+    /** Number of vertices read from the file by the last computeConvexHull **/
+    unsigned long long          numberPoints;
+
+    static bool parseVertex(std::string const &line, double coordinates[3]);
+};
+
+#endif // STREAMINGCONVEXHULLBUILDER_H
@@ -1,11 +1,18 @@
 #include "tetrahedronbuilder.h"
 #include <stdlib.h>
-
-/** @brief Class used to build the starting Tetrahedron, inserts first items in the dcel
- *  @param Dcel dcel**/
-TetrahedronBuilder::TetrahedronBuilder(DrawableDcel* dcel, const std::vector<Dcel::Vertex*> &allVertices){
-    this->dcel = dcel;
-    this->allVertices = allVertices;
+#include <cmath>
+#include <algorithm>
+
+/** @brief Class used to build the starting Tetrahedron, inserts first faces in the hull mesh
+ *  @param HullMesh* hullMesh, std::vector<double> &coordinates packed xyz of all the vertices, reordered by buildTetrahedron,
+ *         FacePlanes* facePlanes where the plane of each face is saved,
+ *         std::mt19937* randomGenerator of the random permutations of the vertices, each shuffle goes on with its sequence**/
+TetrahedronBuilder::TetrahedronBuilder(HullMesh* hullMesh, std::vector<double> &coordinates, FacePlanes* facePlanes, std::mt19937* randomGenerator){
+    this->hullMesh = hullMesh;
+    this->randomGenerator = randomGenerator;
+    this->coordinates = &coordinates;
+    this->facePlanes = facePlanes;
+    this->faceBuilderHelper = nullptr;
 }
 
 /**
@@ -17,80 +24,189 @@ TetrahedronBuilder::~TetrahedronBuilder(){
 
 /**
  * @brief TetrahedronBuilder::buildTetrahedron const builds a tetrahedron with different steps
- *        - Until getting 4 non-coplanar vertices
- *          - Shuffles all vertices
- *          - Gets first four vertices
- *          - Checks Coplanarity
+ *        - Shuffles all vertices once
+ *        - Finds 4 non-coplanar vertices (see findInitialSimplex) and moves them to the first 4 positions
  *        - Builds Tetrahedron using the latter 4 non-coplanar vertices
- *        - Return shuffled Vertices
+ *        The vertices are reordered in place in the packed coordinates, the remaining ones follow the first 4.
+ *        If all the vertices are coplanar (or they are less than 4) there is no tetrahedron: nothing is built
+ *        and false is returned.
+ * @return true if the tetrahedron has been built
  */
-std::vector<Dcel::Vertex*> TetrahedronBuilder::buildTetrahedron(){
+bool TetrahedronBuilder::buildTetrahedron(){
 
-    //Instantiate FaceBuilderHelper
-    faceBuilderHelper = new FaceBuilderHelper(dcel);
+    //shuffles all vertices
+    verticesShuffler();
 
-    //Initialize Array of Shuffled Vertices
-    std::vector<Dcel::Vertex*> shuffledVertices;
-    //Initialize vector that will contain picked 4 points to get checked
-    std::vector<Pointd> fourPoints;
+    //Positions of the 4 vertices of the tetrahedron
+    unsigned int simplex[4];
+    if( !findInitialSimplex(simplex) ){
+        return false;
+    }
 
-    /** Initialize int var coplanarity, tells if the given vertices are coplanar (0) or not (1 or -1)
-     *  if matrix's determinant < 0 coplanarity will return -1 else, it'll return 1 */
-    int coplanarity = 0;
-
-    //while we get 4 not coplanar vertices
-    while(coplanarity == 0){
-        //shuffles all vertices
-        shuffledVertices = verticesShuffler();
-        //gets first 4 points (0-3) from all vertices remaining
-        fourPoints = getFirstFourVertices(shuffledVertices);
-        //check if the first 4 vertices are coplanar (0 not coplanar, 1 coplanar)
-        coplanarity = coplanarityChecker(fourPoints);
+    //Move them to the first 4 positions, keeping track of the ones moved by the swaps
+    for(unsigned int i = 0; i < 4; i++){
+        swapVertices(i, simplex[i]);
+        for(unsigned int j = i + 1; j < 4; j++){
+            if( simplex[j] == i ){
+                simplex[j] = simplex[i];
+            }
+        }
     }
 
-    /** Takes the four non complanar points and inserts them into the dcel to
+    //gets first 4 points (0-3) from all vertices remaining
+    std::vector<Pointd> fourPoints = getFirstFourVertices();
+
+    /** int var coplanarity tells the orientation of the 4 vertices, 1 or -1 since they are not coplanar
+     *  if matrix's determinant < 0 coplanarity will return -1 else, it'll return 1 */
+    int coplanarity = coplanarityChecker(fourPoints);
+
+    //Instantiate FaceBuilderHelper
+    faceBuilderHelper = new FaceBuilderHelper(hullMesh, facePlanes);
+
+    /** Takes the four non complanar points and inserts them into the hull mesh to
      *  build first tetrahedron face, orientation based on determinant value (coplanarity)
      * *Returns new halfedges*/
-    std::vector<Dcel::HalfEdge*> newHalfEdges = tetrahedronMaker(fourPoints, coplanarity);
+    std::vector<unsigned int> newHalfEdges = tetrahedronMaker(fourPoints, coplanarity);
 
-    //Build 3 new faces using the passed halfEdges and Vector
-    faceBuilderHelper->buildFaces(shuffledVertices[3], newHalfEdges);
+    //Build 3 new faces on the fourth vertex using the passed halfEdges and Vector
+    std::vector<unsigned int> newFaces;
+    faceBuilderHelper->buildFaces(3, newHalfEdges, newFaces);
 
-    return shuffledVertices;
+    return true;
 }
 
 /**
- * @brief  std::vector<Dcel::Vertex*> TetrahedronBuilder::verticesShuffler takes allVertices
- * @return returns shuffled array of vertices
+ * @brief  void TetrahedronBuilder::verticesShuffler(unsigned int const &firstVertex)
+ *         Fisher-Yates shuffle of the xyz triples of the packed coordinates from firstVertex on,
+ *         the ones before are left where they are.
+ *         The permutation is drawn from the generator passed to the constructor, so the shuffles of the vertices
+ *         inserted later are independent from the first one, while the same seed still gives the same sequence
+ * @param  unsigned int const &firstVertex first shuffled vertex, 0 by default
  */
-std::vector<Dcel::Vertex*> TetrahedronBuilder::verticesShuffler(){
+void TetrahedronBuilder::verticesShuffler(unsigned int const &firstVertex){
 
-    //From http://en.cppreference.com/w/cpp/algorithm/random_shuffle
-    std::random_device rd;
-    std::mt19937 g(rd());
+    //compute a random permutation of the vertices
+    unsigned int verticesNumber = coordinates->size() / 3;
+    for(unsigned int i = verticesNumber; i > firstVertex + 1; i--){
+        std::uniform_int_distribution<unsigned int> distribution(firstVertex, i - 1);
+        swapVertices(i - 1, distribution(*randomGenerator));
+    }
+}
 
-    //compute a random permutation of the vertices vector
-    std::shuffle(allVertices.begin(), allVertices.end(), g);
+/**
+ * @brief  void TetrahedronBuilder::swapVertices(unsigned int const &i, unsigned int const &j)
+ *         Swaps the xyz triples of two vertices in the packed coordinates
+ * @param  unsigned int const &i, unsigned int const &j
+ */
+void TetrahedronBuilder::swapVertices(unsigned int const &i, unsigned int const &j){
+    std::swap_ranges(coordinates->begin() + i * 3, coordinates->begin() + i * 3 + 3, coordinates->begin() + j * 3);
+}
 
-    //returns shuffled array
-    return allVertices;
+/**
+ * @brief  Pointd TetrahedronBuilder::getPoint(unsigned int const &index) const
+ * @param  unsigned int const &index position of the vertex in the packed coordinates
+ * @return Pointd coordinates of the vertex
+ */
+Pointd TetrahedronBuilder::getPoint(unsigned int const &index) const{
+    return Pointd((*coordinates)[index * 3], (*coordinates)[index * 3 + 1], (*coordinates)[index * 3 + 2]);
+}
+
+/**
+ * @brief  bool TetrahedronBuilder::findInitialSimplex(unsigned int simplex[4]) const
+ *         Finds 4 non-coplanar vertices with a linear scan for each one:
+ *         - The two extreme vertices along the axis on which the vertices are most spread
+ *         - The vertex farthest from the line through them
+ *         - The vertex farthest from the plane through the three of them
+ *         The result does not depend on the order of the vertices, except for ties.
+ * @param  unsigned int simplex[4] positions of the 4 vertices in the packed coordinates
+ * @return false if there are less than 4 vertices or they are all coplanar
+ */
+bool TetrahedronBuilder::findInitialSimplex(unsigned int simplex[4]) const{
+    unsigned int verticesNumber = coordinates->size() / 3;
+    if( verticesNumber < 4 ){
+        return false;
+    }
 
+    //Extreme vertices along each axis
+    unsigned int minIndex[3] = {0, 0, 0}, maxIndex[3] = {0, 0, 0};
+    for(unsigned int i = 1; i < verticesNumber; i++){
+        for(unsigned int axis = 0; axis < 3; axis++){
+            if( (*coordinates)[i * 3 + axis] < (*coordinates)[minIndex[axis] * 3 + axis] ) minIndex[axis] = i;
+            if( (*coordinates)[i * 3 + axis] > (*coordinates)[maxIndex[axis] * 3 + axis] ) maxIndex[axis] = i;
+        }
+    }
+    unsigned int bestAxis = 0;
+    double bestSpread = -1;
+    for(unsigned int axis = 0; axis < 3; axis++){
+        double spread = (*coordinates)[maxIndex[axis] * 3 + axis] - (*coordinates)[minIndex[axis] * 3 + axis];
+        if( spread > bestSpread ){
+            bestSpread = spread;
+            bestAxis = axis;
+        }
+    }
+    if( bestSpread <= 0 ){
+        //All the vertices are the same point
+        return false;
+    }
+    simplex[0] = minIndex[bestAxis];
+    simplex[1] = maxIndex[bestAxis];
+    Pointd p0 = getPoint(simplex[0]);
+    Pointd p1 = getPoint(simplex[1]);
+
+    //Farthest from the line p0 p1
+    double maxValue = 0;
+    for(unsigned int i = 0; i < verticesNumber; i++){
+        double value = (p1 - p0).cross(getPoint(i) - p0).getLengthSquared();
+        if( value > maxValue ){
+            maxValue = value;
+            simplex[2] = i;
+        }
+    }
+    if( maxValue == 0 ){
+        //All the vertices are collinear
+        return false;
+    }
+    Pointd p2 = getPoint(simplex[2]);
+
+    //Farthest from the plane p0 p1 p2
+    Vec3 normal = (p1 - p0).cross(p2 - p0);
+    maxValue = 0;
+    for(unsigned int i = 0; i < verticesNumber; i++){
+        double value = std::abs(normal.dot(getPoint(i) - p0));
+        if( value > maxValue ){
+            maxValue = value;
+            simplex[3] = i;
+        }
+    }
+    if( maxValue > 0 && orient3d(p0, p1, p2, getPoint(simplex[3])) != 0 ){
+        return true;
+    }
+
+    //The farthest vertex may be coplanar because of rounding errors, any vertex off the plane is enough
+    for(unsigned int i = 0; i < verticesNumber; i++){
+        if( orient3d(p0, p1, p2, getPoint(i)) != 0 ){
+            simplex[3] = i;
+            return true;
+        }
+    }
+
+    //All the vertices are coplanar
+    return false;
 }
 
 /**
- * @brief  std::vector <Pointd> TetrahedronBuilder::getFirstFourVertices(std::vector<Dcel::Vertex*> const &allVertices) const
- *         gets first four vertices from all vertices passed
- * @param  std::vector<Dcel::Vertex*> const &allVertices allVertices contains all shuffled vertices
- * @return array of first 4 pointers to vertices
+ * @brief  std::vector <Pointd> TetrahedronBuilder::getFirstFourVertices() const
+ *         gets first four vertices from the packed coordinates
+ * @return array of the coordinates of the first 4 vertices
  */
-std::vector <Pointd> TetrahedronBuilder::getFirstFourVertices(std::vector<Dcel::Vertex*> const &allVertices) const{
+std::vector <Pointd> TetrahedronBuilder::getFirstFourVertices() const{
     //Initializing firstFourVertices Array
     std::vector<Pointd> firstFourVertices;
 
-    firstFourVertices.push_back(allVertices[0]->getCoordinate());
-    firstFourVertices.push_back(allVertices[1]->getCoordinate());
-    firstFourVertices.push_back(allVertices[2]->getCoordinate());
-    firstFourVertices.push_back(allVertices[3]->getCoordinate());
+    firstFourVertices.push_back(getPoint(0));
+    firstFourVertices.push_back(getPoint(1));
+    firstFourVertices.push_back(getPoint(2));
+    firstFourVertices.push_back(getPoint(3));
 
     return firstFourVertices;
 }
@@ -98,138 +214,48 @@ std::vector <Pointd> TetrahedronBuilder::getFirstFourVertices(std::vector<Dcel::
 
 /**
  * @brief  int TetrahedronBuilder::coplanarityChecker(const std::vector<Pointd> &fourPoints) const
+ *         Sign of the determinant of the 4x4 matrix with the points as rows and a last column of ones,
+ *         which is the opposite of orient3d (exact, see predicates.h)
  * @param  std::vector<Pointd> const std::vector<Pointd> &fourPoints
  * @return 0 if coplanar, 1 or -1 else
  */
 int TetrahedronBuilder::coplanarityChecker(const std::vector<Pointd> &fourPoints) const{
-
-    //Initialize Coplanarity
-    bool coplanarity = true;
-    //Tells it the determinant is greater (1) or lesser than 0 (0) for next steps
-    int determinantRes = 0;
-
-    //builds 4*4 matrix using eigen from @https://eigen.tuxfamily.org/dox/group__TutorialMatrixClass.html
-    Eigen::Matrix4d m;
-
-    //Add all the points to the Matrix by their x, y and z coordinates
-    for(int i=0; i<4; i++){
-        m(i, 0) = fourPoints[i].x();
-        m(i, 1) = fourPoints[i].y();
-        m(i, 2) = fourPoints[i].z();
-        m(i, 3) = 1; //last column made of ones
-    }
-
-    //Check Matrix determinant
-    double det = m.determinant();
-
-    //Check if the determinant is +- epsilon
-    coplanarity = det > -std::numeric_limits<double>::epsilon() && det < std::numeric_limits<double>::epsilon();
-
-    //If Coplanar
-    if(!coplanarity){
-        if(det < -std::numeric_limits<double>::epsilon()){
-            determinantRes = -1;
-        } else {
-            determinantRes = 1;
-        }
-    } else {
-        determinantRes = 0;
-    }
-
     //0 coplanar, 1 or -1 if not coplanar
-    return determinantRes;
+    return -orient3d(fourPoints[0], fourPoints[1], fourPoints[2], fourPoints[3]);
 }
 
 /**
- * @brief  void TetrahedronBuilder::tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const
- *         takes the four non-coplanar vertices and inserts their data in the dcel
- *         to build the tetrahedron itself basing orientation on determinant result.
- *         It builds the very first face of the tetrahedron, then, calls an helper function to build
- *         the other 3 faces
+ * @brief  std::vector<unsigned int> TetrahedronBuilder::tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const
+ *         takes the four non-coplanar vertices and builds the very first face of the tetrahedron
+ *         on the first three of them, basing orientation on determinant result.
+ *         The other 3 faces are built by an helper function on the returned halfedges
  * @param  std::vector<Pointd> const &vertices, int const &determinant vertices 4 non-coplanar vertices
+ * @return the 3 halfedges of the first face, each one starting where the previous one ends
  */
-std::vector<Dcel::HalfEdge*> TetrahedronBuilder::tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const{
-
-    //Initialize Vector of Halfedges to contain new HalfEdges and build new faces on them
-    std::vector<Dcel::HalfEdge*> halfEdges;
-
-    //Adding passed vertices to the Dcel and assigning each one of them to a Dcel::Vertex* v
-    Dcel::Vertex* v1 = this->dcel->addVertex(vertices[0]);
-    Dcel::Vertex* v2 = this->dcel->addVertex(vertices[1]);
-    Dcel::Vertex* v3 = this->dcel->addVertex(vertices[2]);
-
-    //Initializing first 3 Half Edges
-    Dcel::HalfEdge* h1 = this->dcel->addHalfEdge();
-    Dcel::HalfEdge* h2 = this->dcel->addHalfEdge();
-    Dcel::HalfEdge* h3 = this->dcel->addHalfEdge();
+std::vector<unsigned int> TetrahedronBuilder::tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const{
 
     /** In order to ensure that we are always working in counter-clockwise way
-      *  we need to change settings based on the determinant calculated before **/
-    //If determinant is > epsilon
+      *  we need to change the order of the vertices based on the determinant calculated before:
+      *  0 -> 1 -> 2 if determinant is positive, 1 -> 0 -> 2 if it is negative **/
+    unsigned int initialFace;
     if(determinant == 1){
-        h1->setFromVertex(v1);
-        h1->setToVertex(v2);
-        h1->setNext(h2);
-        h1->setPrev(h3);
-
-        h2->setFromVertex(v2);
-        h2->setToVertex(v3);
-        h2->setNext(h3);
-        h2->setPrev(h1);
-
-        h3->setFromVertex(v3);
-        h3->setToVertex(v1);
-        h3->setNext(h1);
-        h3->setPrev(h2);
-
-        v1->setIncidentHalfEdge(h1);
-        v2->setIncidentHalfEdge(h2);
-        v3->setIncidentHalfEdge(h3);
-
-
-        //if determinant is < epsilon
-    } else if(determinant == -1) {
-
-        h1->setFromVertex(v2);
-        h1->setToVertex(v1);
-        h1->setNext(h2);
-        h1->setPrev(h1);
-
-        h2->setFromVertex(v1);
-        h2->setToVertex(v3);
-        h2->setNext(h3);
-        h2->setPrev(h1);
-
-        h3->setFromVertex(v3);
-        h3->setToVertex(v2);
-        h3->setNext(h1);
-        h3->setPrev(h2);
-
-
-        v1->setIncidentHalfEdge(h2);
-        v2->setIncidentHalfEdge(h1);
-        v3->setIncidentHalfEdge(h3);
-
+        initialFace = hullMesh->addFace(0, 1, 2);
+    } else {
+        initialFace = hullMesh->addFace(1, 0, 2);
     }
 
-    //Setting the cardinality of vertices
-    v1->setCardinality(2);
-    v2->setCardinality(2);
-    v3->setCardinality(2);
+    //Save the plane of the initial face, following the same counter-clockwise order of its halfedges
+    unsigned int outerHalfEdge = HullMesh::getOuterHalfEdge(initialFace);
+    facePlanes->setPlane(initialFace,
+                         vertices[hullMesh->getFromVertex(outerHalfEdge)],
+                         vertices[hullMesh->getFromVertex(outerHalfEdge + 1)],
+                         vertices[hullMesh->getFromVertex(outerHalfEdge + 2)]);
 
-    //Create and adding a new face based on previous edges
-    Dcel::Face* initialFace = this->dcel->addFace();
-    //Setting Outher Edge to access external face
-    initialFace->setOuterHalfEdge(h1);
-    h1->setFace(initialFace);
-    h2->setFace(initialFace);
-    h3->setFace(initialFace);
-
-    //Add new halfedges to the vector
-    halfEdges.push_back(h1);
-    halfEdges.push_back(h2);
-    halfEdges.push_back(h3);
+    //Return the halfedges of the initial face
+    std::vector<unsigned int> halfEdges;
+    halfEdges.push_back(outerHalfEdge);
+    halfEdges.push_back(outerHalfEdge + 1);
+    halfEdges.push_back(outerHalfEdge + 2);
 
     return halfEdges;
-
 }
@@ -1,30 +1,37 @@
 #ifndef TETRAHEDRONBUILDER_H
 #define TETRAHEDRONBUILDER_H
 
-#include "lib/dcel/drawable_dcel.h"
-#include <eigen3/Eigen/Dense>
-#include <eigen3/Eigen/LU>
 #include <random>
 
+#include "hullmesh.h"
+
 #include "facebuilderhelper.h"
+#include "faceplanes.h"
+#include "predicates.h"
 
 class TetrahedronBuilder{
 
 public:
-    TetrahedronBuilder(DrawableDcel* dcel, const std::vector<Dcel::Vertex*> &allVertices);
+    TetrahedronBuilder(HullMesh* hullMesh, std::vector<double> &coordinates, FacePlanes* facePlanes, std::mt19937* randomGenerator);
     ~TetrahedronBuilder(); //Destructor Declaration
-    std::vector<Dcel::Vertex*> buildTetrahedron();
+    bool buildTetrahedron();
+    void verticesShuffler(unsigned int const &firstVertex = 0);
 
 private:
-    DrawableDcel *dcel;
-    std::vector<Dcel::Vertex*> allVertices;
+    HullMesh *hullMesh;
+    /** Packed xyz of all the vertices, owned by ConvexHullBuilder and reordered in place **/
+    std::vector<double> *coordinates;
     FaceBuilderHelper *faceBuilderHelper;
-
-    std::vector<Dcel::Vertex*> verticesShuffler();
-    std::vector <Pointd> getFirstFourVertices(std::vector<Dcel::Vertex*> const &allVertices) const;
-    void buildTetrahedron(std::vector<Dcel::Vertex*>);
+    FacePlanes *facePlanes;
+    /** Generator of the random permutations, owned by ConvexHullBuilder **/
+    std::mt19937 *randomGenerator;
+
+    void swapVertices(unsigned int const &i, unsigned int const &j);
+    Pointd getPoint(unsigned int const &index) const;
+    bool findInitialSimplex(unsigned int simplex[4]) const;
+    std::vector <Pointd> getFirstFourVertices() const;
     int  coplanarityChecker(const std::vector<Pointd> &fourPoints) const;
-    std::vector<Dcel::HalfEdge*> tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const;
+    std::vector<unsigned int> tetrahedronMaker(std::vector<Pointd> const &vertices, int const &determinant) const;
 
 };
 
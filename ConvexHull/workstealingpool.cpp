@@ -0,0 +1,112 @@
+#include "workstealingpool.h"
+
+/**
+ * @brief WorkStealingPool::WorkStealingPool()
+ * @param unsigned int const &numberOfThreads number of threads running the jobs, 0 means number of hardware threads
+ */
+WorkStealingPool::WorkStealingPool(unsigned int const &numberOfThreads){
+    unsigned int workersNumber = numberOfThreads > 0 ? numberOfThreads : std::thread::hardware_concurrency();
+    if( workersNumber == 0 ){
+        workersNumber = 1;
+    }
+    for(unsigned int w = 0; w < workersNumber; w++){
+        workers.push_back(new Worker());
+    }
+    this->nextWorker = 0;
+}
+
+/**
+ * @brief WorkStealingPool Class Destructor
+ **/
+WorkStealingPool::~WorkStealingPool(){
+    for(auto workerIterator = workers.begin(); workerIterator != workers.end(); workerIterator++){
+        delete *workerIterator;
+    }
+    workers.clear();
+}
+
+/**
+ * @brief WorkStealingPool::submit(std::function<void()> const &job)
+ *        Adds a job to the queue of the next thread, round robin: jobs submitted one after the other
+ *        start on different threads, so the largest jobs should be submitted first.
+ * @param std::function<void()> const &job
+ */
+void WorkStealingPool::submit(std::function<void()> const &job){
+    Worker *worker = workers[nextWorker];
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->jobs.push_back(job);
+    nextWorker = (nextWorker + 1) % workers.size();
+}
+
+/**
+ * @brief WorkStealingPool::run()
+ *        Runs all the submitted jobs and returns when they are all done.
+ *        The calling thread runs the jobs of the first queue, the other queues get a thread of their own.
+ */
+void WorkStealingPool::run(){
+    std::vector<std::thread> threads;
+    for(unsigned int w = 1; w < workers.size(); w++){
+        threads.push_back(std::thread(&WorkStealingPool::work, this, w));
+    }
+    work(0);
+    for(auto threadIterator = threads.begin(); threadIterator != threads.end(); threadIterator++){
+        threadIterator->join();
+    }
+    nextWorker = 0;
+}
+
+/**
+ * @brief WorkStealingPool::getNumberOfThreads() const
+ * @return unsigned int number of threads running the jobs
+ */
+unsigned int WorkStealingPool::getNumberOfThreads() const{
+    return workers.size();
+}
+
+/**
+ * @brief WorkStealingPool::work(unsigned int const &workerIndex)
+ *        Runs the jobs of its own queue, then the ones stolen from the others, until all the queues are empty
+ * @param unsigned int const &workerIndex
+ */
+void WorkStealingPool::work(unsigned int const &workerIndex){
+    std::function<void()> job;
+    while( popJob(workerIndex, job) || stealJob(workerIndex, job) ){
+        job();
+    }
+}
+
+/**
+ * @brief WorkStealingPool::popJob(unsigned int const &workerIndex, std::function<void()> &job)
+ *        Takes the first job of the thread's own queue
+ * @param unsigned int const &workerIndex, std::function<void()> &job set to the job taken
+ * @return false if the queue is empty
+ */
+bool WorkStealingPool::popJob(unsigned int const &workerIndex, std::function<void()> &job){
+    Worker *worker = workers[workerIndex];
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if( worker->jobs.empty() ){
+        return false;
+    }
+    job = worker->jobs.front();
+    worker->jobs.pop_front();
+    return true;
+}
+
+/**
+ * @brief WorkStealingPool::stealJob(unsigned int const &thiefIndex, std::function<void()> &job)
+ *        Takes the last job of the queue of another thread, the queues are visited starting from the next one
+ * @param unsigned int const &thiefIndex, std::function<void()> &job set to the job stolen
+ * @return false if all the other queues are empty, no job is left since jobs cannot submit jobs
+ */
+bool WorkStealingPool::stealJob(unsigned int const &thiefIndex, std::function<void()> &job){
+    for(unsigned int w = 1; w < workers.size(); w++){
+        Worker *victim = workers[(thiefIndex + w) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if( !victim->jobs.empty() ){
+            job = victim->jobs.back();
+            victim->jobs.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
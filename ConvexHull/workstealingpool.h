@@ -0,0 +1,43 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <functional>
+
+/**
+ * @brief WorkStealingPool
+ *        Runs a set of independent jobs on a fixed number of threads. Each thread owns a queue, the jobs are dealt
+ *        to the queues in the order they are submitted, and each thread runs the jobs of its own queue from the front.
+ *        A thread whose queue is empty steals a job from the back of the queue of another thread, so threads which
+ *        got short jobs take over the work left to the others instead of going idle.
+ *        Each queue has its own lock, a thread only waits for another one while they touch the same queue.
+ *        Jobs cannot submit other jobs: all of them are submitted before run().
+ */
+class WorkStealingPool{
+
+public:
+    WorkStealingPool(unsigned int const &numberOfThreads = 0); //Constructor Declaration
+    ~WorkStealingPool(); //Destructor Declaration
+    void submit(std::function<void()> const &job);
+    void run();
+    unsigned int getNumberOfThreads() const;
+
+private:
+    /** Queue of the jobs of one thread, the owner pops from the front and the others steal from the back **/
+    struct Worker{
+        std::mutex mutex;
+        std::deque< std::function<void()> > jobs;
+    };
+    std::vector<Worker*> workers;
+    /** Queue the next submitted job goes to **/
+    unsigned int nextWorker;
+
+    void work(unsigned int const &workerIndex);
+    bool popJob(unsigned int const &workerIndex, std::function<void()> &job);
+    bool stealJob(unsigned int const &thiefIndex, std::function<void()> &job);
+};
+
+#endif // WORKSTEALINGPOOL_H